@@ -0,0 +1,89 @@
+// Throughput of the batch Fleet in float against double for every kernel set
+// this CPU runs, and how far each drifts from the scalar double fleet over the
+// same drive. Each car gets its own throttle, brake and steering pattern.
+// Timings cover Fleet::step only and are nanoseconds per car-step on this
+// machine.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "config/PhysicsConstants.h"
+#include "vehicle/Fleet.h"
+
+namespace {
+    const double STEP = PhysicsConstants::TIME_INTERVAL;
+    const double DURATION = 10.0;
+    const int FLEET_SIZES[] = {64, 1024, 8192};
+
+    template <typename Scalar>
+    double drive(Fleet<Scalar>& fleet, int cars, double origin) {
+        for (int i = 0; i < cars; i++) {
+            fleet.place(origin + 20.0 * (i % 64), origin + 20.0 * (i / 64), 0.01 * i);
+        }
+
+        int steps = static_cast<int>(std::lround(DURATION / STEP));
+        std::chrono::duration<double, std::nano> elapsed{0.0};
+        for (int k = 0; k < steps; k++) {
+            double t = k * STEP;
+            for (int i = 0; i < cars; i++) {
+                double phase = 0.37 * i;
+                typename Fleet<Scalar>::Input input;
+                input.throttle = Scalar(t < 4.0 + std::sin(phase) ? 1.0 : 0.0);
+                input.brake = Scalar(t > 6.0 ? 0.6 : 0.0);
+                input.steering = Scalar(0.3 * std::sin(t + phase));
+                fleet.setInput(i, input);
+            }
+            auto start = std::chrono::steady_clock::now();
+            fleet.step(STEP);
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+        return elapsed.count() / (static_cast<double>(steps) * cars);
+    }
+
+    template <typename Scalar>
+    double maxDivergence(const Fleet<double>& reference, const Fleet<Scalar>& fleet) {
+        double error = 0.0;
+        for (size_t i = 0; i < reference.size(); i++) {
+            int car = static_cast<int>(i);
+            error = std::max(error, (reference.getPosition(car) - fleet.getPosition(car)).norm());
+        }
+        return error;
+    }
+}
+
+int main() {
+    std::printf("%-8s %-6s %-8s %-9s %12s %16s\n", "cars", "scalar", "kernels", "origin", "ns/car-step",
+                "max drift (m)");
+
+    for (int cars : FLEET_SIZES) {
+        for (double origin : {0.0, 1e5}) {
+            Fleet<double> reference;
+            reference.setKernels(*supportedFleetKernels<double>().front());
+            drive(reference, cars, origin);
+
+            for (const FleetKernels<double>* kernels : supportedFleetKernels<double>()) {
+                Fleet<double> fleet;
+                fleet.setKernels(*kernels);
+                double cost = drive(fleet, cars, origin);
+                std::printf("%-8d %-6s %-8s %-9g %12.1f %16.3e\n", cars, "double", kernels->name, origin, cost,
+                            maxDivergence(reference, fleet));
+            }
+            for (const FleetKernels<float>* kernels : supportedFleetKernels<float>()) {
+                Fleet<float> fleet;
+                fleet.setKernels(*kernels);
+                double cost = drive(fleet, cars, origin);
+                std::printf("%-8d %-6s %-8s %-9g %12.1f %16.3e\n", cars, "float", kernels->name, origin, cost,
+                            maxDivergence(reference, fleet));
+            }
+
+            Fleet<float> absolute;
+            absolute.setFloatingOrigin(false);
+            double cost = drive(absolute, cars, origin);
+            std::printf("%-8d %-6s %-8s %-9s %12.1f %16.3e\n", cars, "float", absolute.getKernelName(), "(fixed)",
+                        cost, maxDivergence(reference, absolute));
+        }
+    }
+    return 0;
+}
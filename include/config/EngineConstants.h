@@ -5,9 +5,6 @@
 #ifndef SIMPLETRAFFICGAME_ENGINECONSTANTS_H
 #define SIMPLETRAFFICGAME_ENGINECONSTANTS_H
 
-#endif
-
-
 namespace EngineConstants
 {
     const double INTAKE_MANIFOLD_PRESSURE = 101325;
@@ -20,4 +17,7 @@ namespace EngineConstants
     const double R_AIR = 287;
     const double AIR_TEMP = 298;
     const double ENGINE_FRICTION_COEFFICIENT = 0.02;
+    const double STALL_RPM = 800;
 }
+
+#endif
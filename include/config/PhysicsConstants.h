@@ -3,8 +3,6 @@
 
 #include <cmath>
 
-#include "vehicle/Gearbox.h"
-
 namespace PhysicsConstants {
     constexpr double DEG_TO_RAD = M_PI / 180.0;
     constexpr double RAD_TO_DEG = 180.0 / M_PI;
@@ -14,6 +12,10 @@ namespace PhysicsConstants {
     constexpr double TIME_INTERVAL = 0.016;
     constexpr int SDL_TIME_INTERVAL = 16;
 
+    // Subsystem rates for multi-rate stepping (--multi-rate).
+    constexpr double WHEEL_RATE = 1000.0;
+    constexpr double CHASSIS_RATE = 250.0;
+
     constexpr double WHEEL_RADIUS = 0.33;
     constexpr double WHEEL_FRICTION = 1.0;
     constexpr double WHEEL_MASS = 20.0;
@@ -35,13 +37,21 @@ namespace PhysicsConstants {
 
     constexpr double CAR_MASS = 1200.0;
     constexpr double CAR_WEIGHT = CAR_MASS * 9.81;
+    constexpr double CAR_BODY_WIDTH = 2.5;
+    constexpr double CAR_BODY_LENGTH = 4.5;
+    constexpr double CAR_MOMENT_OF_INERTIA = (CAR_MASS / 12.0) * (
+        CAR_BODY_WIDTH * CAR_BODY_WIDTH + CAR_BODY_LENGTH * CAR_BODY_LENGTH
+    );
     constexpr double CAR_TOP_SPEED = 50.0;
 
     constexpr double STEERING_RACK = 1.5;
     constexpr double MAX_STEERING_ANGLE = 55.0 * DEG_TO_RAD;
     constexpr double FORCE_FEEDBACK_DECAY = 0.985;
 
+    constexpr double WHEELBASE = 1.8;
+    constexpr double TRACK_WIDTH = 1.0;
     constexpr double CG_HEIGHT = 0.5;
+    constexpr double FRONT_WEIGHT_BIAS = 0.6;
     constexpr double CLUTCH_MAX_TORQUE = 750.0;
     constexpr double CLUTCH_SLIP_K = 4.5;
     constexpr double CLUTCH_LOCK_THRESHOLD = 0.70;
@@ -14,13 +14,6 @@ namespace RenderingConstants {
     extern int CAR_WIDTH;
     extern int CAR_LENGTH;
 
-    extern double WHEELBASE;
-    extern double TRACK_WIDTH;
-    extern double CAR_MOMENT_OF_INERTIA;
-
-    constexpr double WHEEL_WIDTH_INSET = 0.1;
-    constexpr double WHEEL_LENGTH_INSET = 0.15;
-
     void initializeScreenDependentConstants(int screenWidth, int screenHeight);
 }
 
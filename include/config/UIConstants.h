@@ -1,7 +1,17 @@
 #ifndef UICONSTANTS_H
 #define UICONSTANTS_H
 
+#include <cstddef>
+
 namespace UIConstants {
+    constexpr size_t GRAPH_HISTORY_POINTS = 600;
+    constexpr size_t GRAPH_MIN_VISIBLE_SAMPLES = 60;
+    constexpr size_t GRAPH_MAX_VISIBLE_SAMPLES = 3600000;
+    constexpr double GRAPH_ZOOM_STEP = 2.0;
+    constexpr double HUD_REFRESH_HZ = 10.0;
+    constexpr double GRAPH_SAMPLE_HZ = 60.0;
+    constexpr double REWIND_SECONDS = 2.0;
+    constexpr unsigned char GHOST_ALPHA = 110;
 }
 
 #endif
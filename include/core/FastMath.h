@@ -0,0 +1,420 @@
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+// Polynomial stand-ins for the libm functions the physics steps call,
+// accurate to about single precision instead of the last bit. Each takes a
+// float or double, or an Eigen array elementwise. There are no branches or
+// select()s, which Eigen 3.4 does not vectorize: range reduction and signs
+// are done with rounding, min/max and abs, so the array versions vectorize
+// where Eigen's own fall back to libm (sin/cos in double, atan in both).
+// bench/FastMathBench measures them against libm over the ranges the
+// simulation hits.
+//
+// Max error in double, for the arguments given:
+//   sin, cos     5e-8 absolute   |x| < 1e4
+//   tan          2e-7 relative   |x| < 1.4, growing as 1/cos^2 beyond
+//   atan, atan2  4e-8 absolute   any; atan2(0, 0) is 0, and -0 counts as +0
+//   exp          8e-8 relative   |x| < 700 (float: 87), clamped beyond
+//   log          3e-8 absolute   x > 0
+//   pow          exp(y log x)    x > 0
+// Float adds its own rounding, a few 1e-7, and sin/cos lose ulp(x) to the
+// range reduction.
+namespace FastMath {
+
+namespace detail {
+    template <typename T, typename = void>
+    struct Traits {
+        using Plain = typename T::PlainObject;
+        using Scalar = typename T::Scalar;
+        static constexpr bool IS_SCALAR = false;
+    };
+
+    template <typename T>
+    struct Traits<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+        using Plain = T;
+        using Scalar = T;
+        static constexpr bool IS_SCALAR = true;
+    };
+
+    template <typename T>
+    using Plain = typename Traits<T>::Plain;
+
+    template <typename T>
+    T abs(const T& x) {
+        if constexpr (Traits<T>::IS_SCALAR) {
+            return std::abs(x);
+        } else {
+            return x.abs();
+        }
+    }
+
+    template <typename T>
+    T clamp(const T& x, typename Traits<T>::Scalar low, typename Traits<T>::Scalar high) {
+        if constexpr (Traits<T>::IS_SCALAR) {
+            return std::min(std::max(x, low), high);
+        } else {
+            return x.max(low).min(high);
+        }
+    }
+
+    // -1, 0 or 1; anything from the smallest normal number up counts as
+    // nonzero.
+    template <typename T>
+    T sign(const T& x) {
+        using Scalar = typename Traits<T>::Scalar;
+        return detail::clamp<T>(x * (Scalar(1) / std::numeric_limits<Scalar>::min()), Scalar(-1), Scalar(1));
+    }
+
+    // Round to nearest by pushing the fraction out of the mantissa; valid for
+    // |x| below 2^51 (double) or 2^22 (float). Unlike std::round this never
+    // becomes a libm call.
+    template <typename T>
+    T round(const T& x) {
+        using Scalar = typename Traits<T>::Scalar;
+        const Scalar shift = Scalar(1.5) * Scalar(1ull << (std::numeric_limits<Scalar>::digits - 1));
+        return (x + shift) - shift;
+    }
+
+    // x = y + k pi with |y| <= pi/2; halfTurnSign is (-1)^k, so sin(x) =
+    // halfTurnSign sin(y) and cos(x) = halfTurnSign cos(y).
+    template <typename T>
+    void reduceHalfTurns(const T& x, T& y, T& halfTurnSign) {
+        using Scalar = typename Traits<T>::Scalar;
+        const Scalar pi = Scalar(M_PI);
+        const Scalar piLow = Scalar(M_PI - double(pi));
+
+        T halfTurns = detail::round<T>(x * Scalar(1.0 / M_PI));
+        y = (x - halfTurns * pi) - halfTurns * piLow;
+        T odd = detail::abs<T>(halfTurns - Scalar(2) * detail::round<T>(halfTurns * Scalar(0.5)));
+        halfTurnSign = Scalar(1) - Scalar(2) * odd;
+    }
+
+    // Minimax fits on [-pi/2, pi/2].
+    template <typename T>
+    T sinPolynomial(const T& y) {
+        using Scalar = typename Traits<T>::Scalar;
+        T y2 = y * y;
+        T p = y2 * Scalar(2.59048851496190536e-06) + Scalar(-1.98008977713614595e-04);
+        p = p * y2 + Scalar(8.33289982352622343e-03);
+        p = p * y2 + Scalar(-1.66666476346535917e-01);
+        p = p * y2 + Scalar(9.99999976589915708e-01);
+        return p * y;
+    }
+
+    template <typename T>
+    T cosPolynomial(const T& y) {
+        using Scalar = typename Traits<T>::Scalar;
+        T y2 = y * y;
+        T p = y2 * Scalar(2.31539520712168109e-05) + Scalar(-1.38537054405442603e-03);
+        p = p * y2 + Scalar(4.16635849024190326e-02);
+        p = p * y2 + Scalar(-4.99999053613995610e-01);
+        p = p * y2 + Scalar(9.99999953493103850e-01);
+        return p;
+    }
+
+    template <typename T>
+    T sin(const T& x) {
+        T y, halfTurnSign;
+        reduceHalfTurns(x, y, halfTurnSign);
+        return halfTurnSign * sinPolynomial(y);
+    }
+
+    template <typename T>
+    T cos(const T& x) {
+        T y, halfTurnSign;
+        reduceHalfTurns(x, y, halfTurnSign);
+        return halfTurnSign * cosPolynomial(y);
+    }
+
+    template <typename T>
+    T tan(const T& x) {
+        T y, halfTurnSign;
+        reduceHalfTurns(x, y, halfTurnSign);
+        return sinPolynomial(y) / cosPolynomial(y);
+    }
+
+    // atan(t) = pi/4 + atan(u) for u = (t - 1) / (t + 1), which maps t >= 0,
+    // infinity included, onto u in [-1, 1] without a branch. atan(u) is fitted
+    // as pi/4 u + u (1 - u^2) Q(u^2) so that t = 0 and t = inf come out as
+    // exactly 0 and pi/2.
+    template <typename T>
+    T atanOfRatio(const T& u) {
+        using Scalar = typename Traits<T>::Scalar;
+        T u2 = u * u;
+        T q = u2 * Scalar(3.97522492531635698e-03) + Scalar(-1.76118332505628258e-02);
+        q = q * u2 + Scalar(3.79193987569175359e-02);
+        q = q * u2 + Scalar(-5.82367161768818205e-02);
+        q = q * u2 + Scalar(8.07512480810038224e-02);
+        q = q * u2 + Scalar(-1.18695969611733182e-01);
+        q = q * u2 + Scalar(2.14601137572709262e-01);
+        return Scalar(M_PI / 4.0) * (Scalar(1) + u) + u * (Scalar(1) - u2) * q;
+    }
+
+    template <typename T>
+    T atan(const T& x) {
+        using Scalar = typename Traits<T>::Scalar;
+        T u = Scalar(1) - Scalar(2) / (detail::abs(x) + Scalar(1));
+        return detail::sign(x) * atanOfRatio(u);
+    }
+
+    template <typename T>
+    T atan2(const T& y, const T& x) {
+        using Scalar = typename Traits<T>::Scalar;
+        const Scalar halfPi = Scalar(M_PI / 2.0);
+        T ax = detail::abs(x);
+        T ay = detail::abs(y);
+        T xSign = detail::sign(x);
+        T ySign = detail::sign(y);
+
+        // Angle from the x axis in [0, pi]; pi/2 on the y axis.
+        T sum = detail::clamp<T>(ay + ax, std::numeric_limits<Scalar>::min(), std::numeric_limits<Scalar>::infinity());
+        T angle = atanOfRatio(T((ay - ax) / sum));
+        angle = halfPi + (angle - halfPi) * xSign;
+        // On the x axis: 0 or pi, and 0 at the origin.
+        T side = ySign + (Scalar(1) - detail::abs(ySign)) * detail::abs(xSign);
+        return angle * side;
+    }
+
+    template <typename Scalar>
+    struct FloatBits;
+
+    template <>
+    struct FloatBits<double> {
+        using Int = std::uint64_t;
+        static constexpr int MANTISSA = 52;
+        static constexpr Int BIAS = 1023;
+        static constexpr Int SQRT_HALF = 0x3FE6A09E667F3BCDull;
+        static constexpr double MAX_EXP = 709.0;
+    };
+
+    template <>
+    struct FloatBits<float> {
+        using Int = std::uint32_t;
+        static constexpr int MANTISSA = 23;
+        static constexpr Int BIAS = 127;
+        static constexpr Int SQRT_HALF = 0x3F3504F3u;
+        static constexpr float MAX_EXP = 88.0f;
+    };
+
+    // The same value's bits as unsigned integers, lane by lane.
+    template <typename T, typename = void>
+    struct BitsOf {
+        using Scalar = typename Traits<T>::Scalar;
+        using Type = Eigen::Array<typename FloatBits<Scalar>::Int, T::RowsAtCompileTime, T::ColsAtCompileTime>;
+    };
+
+    template <typename T>
+    struct BitsOf<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+        using Type = typename FloatBits<T>::Int;
+    };
+
+    template <typename T>
+    typename BitsOf<T>::Type toBits(const T& x) {
+        typename BitsOf<T>::Type bits;
+        if constexpr (Traits<T>::IS_SCALAR) {
+            std::memcpy(&bits, &x, sizeof(x));
+        } else {
+            bits.resize(x.rows(), x.cols());
+            std::memcpy(bits.data(), x.data(), sizeof(typename T::Scalar) * x.size());
+        }
+        return bits;
+    }
+
+    template <typename T, typename B>
+    T fromBits(const B& bits) {
+        T x;
+        if constexpr (Traits<T>::IS_SCALAR) {
+            std::memcpy(&x, &bits, sizeof(x));
+        } else {
+            x.resize(bits.rows(), bits.cols());
+            std::memcpy(x.data(), bits.data(), sizeof(typename T::Scalar) * x.size());
+        }
+        return x;
+    }
+
+    template <int N, typename B>
+    B shiftLeft(const B& bits) {
+        if constexpr (std::is_integral<B>::value) {
+            return bits << N;
+        } else {
+            return bits.template shiftLeft<N>();
+        }
+    }
+
+    template <int N, typename B>
+    B shiftRight(const B& bits) {
+        if constexpr (std::is_integral<B>::value) {
+            return bits >> N;
+        } else {
+            return bits.template shiftRight<N>();
+        }
+    }
+
+    template <typename T, typename B>
+    T toFloat(const B& bits) {
+        if constexpr (Traits<T>::IS_SCALAR) {
+            return T(bits);
+        } else {
+            return bits.template cast<typename T::Scalar>();
+        }
+    }
+
+    // exp(x) = 2^k exp(r) with |r| <= ln2 / 2. Adding 2^MANTISSA puts the
+    // biased exponent k + BIAS in the low mantissa bits, and shifting those
+    // into the exponent field builds 2^k.
+    template <typename T>
+    T exp(const T& x) {
+        using Scalar = typename Traits<T>::Scalar;
+        using Bits = FloatBits<Scalar>;
+        T clamped = detail::clamp<T>(x, -Bits::MAX_EXP, Bits::MAX_EXP);
+        T k = detail::round<T>(clamped * Scalar(1.4426950408889634));
+        T r = (clamped - k * Scalar(6.93145751953125e-1)) - k * Scalar(1.42860682030941723212e-6);
+
+        T p = r * Scalar(8.29765501448213432e-03) + Scalar(4.19153819886610977e-02);
+        p = p * r + Scalar(1.66675747297227471e-01);
+        p = p * r + Scalar(4.99988948512529255e-01);
+        p = p * r + Scalar(9.99999691991231230e-01);
+        p = p * r + Scalar(1.00000007165467755e+00);
+
+        T biased = k + Scalar(Bits::BIAS) + Scalar(typename Bits::Int(1) << Bits::MANTISSA);
+        return p * fromBits<T>(shiftLeft<Bits::MANTISSA>(toBits(biased)));
+    }
+
+    // log(x) = e ln2 + log(m) with m in [sqrt(1/2), sqrt(2)), and log(m) =
+    // 2 atanh(s) for s = (m - 1) / (m + 1). Offsetting the bits by
+    // sqrt(1/2)'s mantissa makes the exponent field round to that interval.
+    template <typename T>
+    T log(const T& x) {
+        using Scalar = typename Traits<T>::Scalar;
+        using Bits = FloatBits<Scalar>;
+        const typename Bits::Int one = Bits::BIAS << Bits::MANTISSA;
+
+        auto bits = toBits(x);
+        auto biasedExponent = shiftRight<Bits::MANTISSA>(decltype(bits)(bits + (one - Bits::SQRT_HALF)));
+        T m = fromBits<T>(decltype(bits)(bits + one - shiftLeft<Bits::MANTISSA>(biasedExponent)));
+        T exponent = toFloat<T>(biasedExponent) - Scalar(Bits::BIAS);
+
+        T s = (m - Scalar(1)) / (m + Scalar(1));
+        T s2 = s * s;
+        T p = s2 * Scalar(4.15177057413277073e-01) + Scalar(6.66440780523511134e-01);
+        p = p * s2 + Scalar(2.00000083703738126e+00);
+        return exponent * Scalar(0.6931471805599453) + p * s;
+    }
+}
+
+template <typename T>
+detail::Plain<T> sin(const T& x) { return detail::sin<detail::Plain<T>>(x); }
+
+template <typename T>
+detail::Plain<T> cos(const T& x) { return detail::cos<detail::Plain<T>>(x); }
+
+template <typename T>
+detail::Plain<T> tan(const T& x) { return detail::tan<detail::Plain<T>>(x); }
+
+template <typename T>
+detail::Plain<T> atan(const T& x) { return detail::atan<detail::Plain<T>>(x); }
+
+template <typename T>
+detail::Plain<T> atan2(const T& y, const T& x) { return detail::atan2<detail::Plain<T>>(y, x); }
+
+template <typename T>
+detail::Plain<T> exp(const T& x) { return detail::exp<detail::Plain<T>>(x); }
+
+template <typename T>
+detail::Plain<T> log(const T& x) { return detail::log<detail::Plain<T>>(x); }
+
+// x > 0.
+template <typename T, typename E>
+detail::Plain<T> pow(const T& x, const E& exponent) {
+    using Plain = detail::Plain<T>;
+    return detail::exp<Plain>(exponent * detail::log<Plain>(x));
+}
+
+}
+
+// libm for scalars and Eigen's elementwise functions for arrays: the
+// reference FastMath is measured against.
+namespace StdMath {
+
+template <typename T>
+FastMath::detail::Plain<T> sin(const T& x) {
+    if constexpr (std::is_floating_point<T>::value) return std::sin(x); else return x.sin();
+}
+
+template <typename T>
+FastMath::detail::Plain<T> cos(const T& x) {
+    if constexpr (std::is_floating_point<T>::value) return std::cos(x); else return x.cos();
+}
+
+template <typename T>
+FastMath::detail::Plain<T> tan(const T& x) {
+    if constexpr (std::is_floating_point<T>::value) return std::tan(x); else return x.tan();
+}
+
+template <typename T>
+FastMath::detail::Plain<T> atan(const T& x) {
+    if constexpr (std::is_floating_point<T>::value) return std::atan(x); else return x.atan();
+}
+
+template <typename T>
+FastMath::detail::Plain<T> atan2(const T& y, const T& x) {
+    if constexpr (std::is_floating_point<T>::value) {
+        return std::atan2(y, x);
+    } else {
+        using Scalar = typename T::Scalar;
+        return y.binaryExpr(x, [](Scalar a, Scalar b) { return std::atan2(a, b); });
+    }
+}
+
+template <typename T>
+FastMath::detail::Plain<T> exp(const T& x) {
+    if constexpr (std::is_floating_point<T>::value) return std::exp(x); else return x.exp();
+}
+
+template <typename T>
+FastMath::detail::Plain<T> log(const T& x) {
+    if constexpr (std::is_floating_point<T>::value) return std::log(x); else return x.log();
+}
+
+template <typename T, typename E>
+FastMath::detail::Plain<T> pow(const T& x, const E& exponent) {
+    if constexpr (std::is_floating_point<T>::value) return std::pow(x, exponent); else return x.pow(exponent);
+}
+
+}
+
+// What the physics steps call: FastMath when built with -DFAST_MATH=ON
+// (CARPHYS_FAST_MATH), StdMath otherwise. Recordings, replays and the tests'
+// reference values assume the default.
+namespace PhysicsMath {
+#ifdef CARPHYS_FAST_MATH
+using FastMath::sin;
+using FastMath::cos;
+using FastMath::tan;
+using FastMath::atan;
+using FastMath::atan2;
+using FastMath::exp;
+using FastMath::log;
+using FastMath::pow;
+#else
+using StdMath::sin;
+using StdMath::cos;
+using StdMath::tan;
+using StdMath::atan;
+using StdMath::atan2;
+using StdMath::exp;
+using StdMath::log;
+using StdMath::pow;
+#endif
+}
+
+#endif
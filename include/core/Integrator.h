@@ -0,0 +1,90 @@
+#ifndef INTEGRATOR_H
+#define INTEGRATOR_H
+
+// Fixed-step integrators for x'' = a(x, v). x is the displacement over the
+// step and starts at zero; v is the velocity. Each scheme is handed the
+// acceleration at the start of the step, a0, from the body's force
+// accumulation and calls accel(x, v) only for the extra evaluations it
+// needs, so single-evaluation schemes cost nothing beyond the update itself.
+// X and V may be scalars or Eigen vectors.
+namespace Integrators {
+
+// x += v dt + a0 dt^2 / 2, v += a0 dt. Exact for constant forces; this is
+// the scheme the simulation was built and recorded with.
+struct ConstantAcceleration {
+    static constexpr const char* NAME = "ConstantAcceleration";
+    static constexpr int EVALUATIONS = 1;
+
+    template <typename X, typename V, typename Accel>
+    static void step(X& x, V& v, const V& a0, Accel&&, double dt) {
+        x += v * dt + 0.5 * a0 * dt * dt;
+        v = v + a0 * dt;
+    }
+};
+
+// Symplectic Euler: velocity first, then position with the new velocity.
+struct SemiImplicitEuler {
+    static constexpr const char* NAME = "SemiImplicitEuler";
+    static constexpr int EVALUATIONS = 1;
+
+    template <typename X, typename V, typename Accel>
+    static void step(X& x, V& v, const V& a0, Accel&&, double dt) {
+        v = v + a0 * dt;
+        x += v * dt;
+    }
+};
+
+// Velocity Verlet with the end-of-step acceleration evaluated at a
+// predicted velocity, since tire forces depend on velocity.
+struct VelocityVerlet {
+    static constexpr const char* NAME = "VelocityVerlet";
+    static constexpr int EVALUATIONS = 2;
+
+    template <typename X, typename V, typename Accel>
+    static void step(X& x, V& v, const V& a0, Accel&& accel, double dt) {
+        x += v * dt + 0.5 * a0 * dt * dt;
+        V predicted = v + a0 * dt;
+        V a1 = accel(x, predicted);
+        v = v + 0.5 * (a0 + a1) * dt;
+    }
+};
+
+// Classic fourth-order Runge-Kutta; forces are re-evaluated at the three
+// intermediate stages.
+struct RungeKutta4 {
+    static constexpr const char* NAME = "RungeKutta4";
+    static constexpr int EVALUATIONS = 4;
+
+    template <typename X, typename V, typename Accel>
+    static void step(X& x, V& v, const V& a0, Accel&& accel, double dt) {
+        double half = 0.5 * dt;
+
+        V v2 = v + a0 * half;
+        V a2 = accel(X(x + v * half), v2);
+
+        V v3 = v + a2 * half;
+        V a3 = accel(X(x + v2 * half), v3);
+
+        V v4 = v + a3 * dt;
+        V a4 = accel(X(x + v3 * dt), v4);
+
+        x += (v + 2.0 * v2 + 2.0 * v3 + v4) * (dt / 6.0);
+        v = v + (a0 + 2.0 * a2 + 2.0 * a3 + a4) * (dt / 6.0);
+    }
+};
+
+}
+
+// Per-body-type selection, set with the CHASSIS_INTEGRATOR and
+// WHEEL_INTEGRATOR CMake cache variables.
+#ifndef CHASSIS_INTEGRATOR
+#define CHASSIS_INTEGRATOR ConstantAcceleration
+#endif
+#ifndef WHEEL_INTEGRATOR
+#define WHEEL_INTEGRATOR ConstantAcceleration
+#endif
+
+using ChassisIntegrator = Integrators::CHASSIS_INTEGRATOR;
+using WheelIntegrator = Integrators::WHEEL_INTEGRATOR;
+
+#endif
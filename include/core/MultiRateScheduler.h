@@ -0,0 +1,53 @@
+#ifndef MULTIRATESCHEDULER_H
+#define MULTIRATESCHEDULER_H
+
+#include <functional>
+#include <vector>
+
+// Runs tasks at their own fixed rates off one clock ticking at the fastest
+// task's rate. Each task keeps a phase accumulator, so a rate that doesn't
+// divide the base rate (60 Hz on a 1 kHz base) still runs exactly `rate`
+// times per simulated second, on whole base ticks. Tasks due on the same tick
+// run in the order they were added, and each is passed the time since it
+// last ran.
+class MultiRateScheduler {
+public:
+    using Task = std::function<void(double dt)>;
+
+    // Returns the task's id. Add every task before the first advance.
+    int addTask(double rate, Task task);
+
+    // Runs every tick that falls within the next `seconds`. Time left over
+    // carries into the next call.
+    void advance(double seconds);
+
+    // Restarts the clock at `time` with every task's phase cleared.
+    void reset(double time = 0.0);
+
+    // Time of the last tick run.
+    double getTime() const { return origin + ticks * basePeriod; }
+    double getBasePeriod() const { return basePeriod; }
+    long getRunCount(int task) const { return tasks[task].runs; }
+
+private:
+    struct Entry {
+        double rate;
+        Task task;
+        // Accumulates `rate` per tick and runs the task each time it reaches
+        // the base rate.
+        double phase;
+        long lastTick;
+        long runs;
+    };
+
+    std::vector<Entry> tasks;
+    double baseRate{0.0};
+    double basePeriod{0.0};
+    double origin{0.0};
+    long ticks{0};
+    double pending{0.0};
+
+    void tick();
+};
+
+#endif
@@ -4,6 +4,8 @@
 #include <map>
 #include <string>
 
+#include "core/Integrator.h"
+
 class Camera;
 
 class RigidBody {
@@ -40,7 +42,32 @@ public:
 
     void updateAcceleration();
 
+    // Integrates the forces and torque accumulated this step, held constant
+    // over the step, then clears them.
     void incrementTime(double time_interval);
+
+    // Same, with accel(displacement, velocity) re-evaluating the
+    // acceleration at the integrator's intermediate states. Both vectors are
+    // (x m, y m, angle rad) and their rates.
+    template <typename Integrator, typename Accel>
+    void integrate(double time_interval, Accel&& accel);
+
+private:
+    int debugFrameCount{0};
+
+    void finishStep(const Eigen::Vector3d& displacement, const Eigen::Vector3d& newVelocity);
 };
 
+template <typename Integrator, typename Accel>
+void RigidBody::integrate(double time_interval, Accel&& accel) {
+    updateAcceleration();
+
+    Eigen::Vector3d displacement = Eigen::Vector3d::Zero();
+    Eigen::Vector3d state(velocity.x(), velocity.y(), angular_velocity);
+    Eigen::Vector3d initialAcceleration(acceleration.x(), acceleration.y(), angular_acceleration);
+    Integrator::step(displacement, state, initialAcceleration, accel, time_interval);
+
+    finishStep(displacement, state);
+}
+
 #endif
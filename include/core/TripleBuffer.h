@@ -0,0 +1,47 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free latest-value handoff between one writer thread and one reader
+// thread. The writer fills its private slot and publishes it by swapping it
+// with the shared middle slot; the reader swaps the middle slot for its own
+// when something new was published. Neither side ever waits, and the reader
+// always sees a complete value, skipping any it was too slow to pick up.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Writer side.
+    T& writeBuffer() { return slots[back]; }
+
+    void publish() {
+        back = middle.exchange(static_cast<uint8_t>(back | FRESH), std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // Reader side. Returns true if a newer value was picked up.
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    const T& read() const { return slots[front]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH = 0x4;
+
+    T slots[3]{};
+    alignas(64) uint8_t back{0};
+    alignas(64) uint8_t front{1};
+    alignas(64) std::atomic<uint8_t> middle{2};
+};
+
+#endif
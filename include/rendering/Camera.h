@@ -1,6 +1,18 @@
 #ifndef CAMERA_H
 #define CAMERA_H
 
+// Axis-aligned rectangle in world units.
+struct WorldRect {
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+
+    bool intersects(const WorldRect& other) const {
+        return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+    }
+};
+
 class Camera {
 public:
     double camera_x;
@@ -14,6 +26,9 @@ public:
 
     int worldToScreenX(double world_x, int screen_width) const;
     int worldToScreenY(double world_y, int screen_height) const;
+
+    // World area covered by a screen of the given size.
+    WorldRect visibleRect(int screen_width, int screen_height) const;
 };
 
 #endif
\ No newline at end of file
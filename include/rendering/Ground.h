@@ -2,18 +2,65 @@
 #define GROUND_H
 
 #include <SDL_render.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <vector>
 
 class Camera;
 
+// Ground drawn from square tiles in world space. Each tile is rasterized once
+// into a texture, with the grid and any decorators, and then just blitted as
+// the camera moves. Tiles are created on first use and the least recently
+// drawn ones are evicted once the cache is full.
 class Ground {
 public:
+    // Draws extra content (track markings, surfaces) into a tile. The render
+    // target is the tile texture, so draw at world coordinates minus
+    // tileBounds.x / tileBounds.y.
+    using TileDecorator = std::function<void(SDL_Renderer* renderer, const SDL_Rect& tileBounds)>;
+
+    static constexpr int DEFAULT_TILE_SIZE = 512;
+    static constexpr size_t DEFAULT_MAX_CACHED_TILES = 64;
+
     int grid_spacing;
     unsigned char line_r, line_g, line_b;
 
-    Ground(int spacing = 100);
+    Ground(int spacing = 100, int tileSize = DEFAULT_TILE_SIZE, size_t maxCachedTiles = DEFAULT_MAX_CACHED_TILES);
+    ~Ground();
+
+    Ground(const Ground&) = delete;
+    Ground& operator=(const Ground&) = delete;
 
     void draw(SDL_Renderer* renderer, const Camera* camera,
               int screenWidth, int screenHeight);
+
+    void addDecorator(TileDecorator decorator);
+    // Drops every cached tile, e.g. after changing the grid colour.
+    void invalidate();
+
+    size_t getCachedTileCount() const { return tiles.size(); }
+
+private:
+    struct Tile {
+        SDL_Texture* texture;
+        std::list<uint64_t>::iterator lruPosition;
+    };
+
+    int tileSize;
+    size_t maxCachedTiles;
+    SDL_Renderer* cachedRenderer;
+
+    std::unordered_map<uint64_t, Tile> tiles;
+    std::list<uint64_t> lru;
+    std::vector<TileDecorator> decorators;
+
+    static uint64_t tileKey(int64_t tileX, int64_t tileY);
+    SDL_Texture* getTile(SDL_Renderer* renderer, int64_t tileX, int64_t tileY);
+    SDL_Texture* rasterizeTile(SDL_Renderer* renderer, int64_t tileX, int64_t tileY);
+    void evictOldest();
 };
 
 #endif
@@ -0,0 +1,45 @@
+#ifndef RENDERBATCH_H
+#define RENDERBATCH_H
+
+#include <SDL_render.h>
+#include <cstddef>
+#include <vector>
+
+// Collects untextured, vertex-coloured triangles per layer and submits each
+// layer with a single SDL_RenderGeometry call. Lines become thin quads so
+// they share the same call. Layers are flushed back to front in enum order;
+// within a layer, shapes keep the order they were added.
+class RenderBatch {
+public:
+    enum Layer {
+        BODIES,
+        WHEELS,
+        DEBUG,
+        LAYER_COUNT
+    };
+
+    void addTriangle(Layer layer, SDL_FPoint a, SDL_FPoint b, SDL_FPoint c, SDL_Color color);
+    // Corners in winding order; the quad must be convex.
+    void addQuad(Layer layer, const SDL_FPoint corners[4], SDL_Color color);
+    void addRect(Layer layer, float x, float y, float w, float h, SDL_Color color);
+    void addLine(Layer layer, float x1, float y1, float x2, float y2, SDL_Color color, float thickness = 1.0f);
+
+    // Draws every non-empty layer and empties the batch. Returns the number
+    // of draw calls issued.
+    int flush(SDL_Renderer* renderer);
+    void clear();
+
+    size_t getVertexCount(Layer layer) const { return layers[layer].vertices.size(); }
+
+private:
+    struct LayerGeometry {
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+
+    LayerGeometry layers[LAYER_COUNT];
+
+    int addVertex(LayerGeometry& geometry, SDL_FPoint position, SDL_Color color);
+};
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "rendering/Camera.h"
+
+// Uniform hash grid over world space used to find the objects a rectangle
+// (normally the camera view) overlaps. Objects are small integer ids with a
+// bounding box; moving one only touches the grid when it crosses into a
+// different set of cells. Query cost depends on the cells and objects in the
+// area, not on how many objects exist. Not thread-safe, including query().
+class SpatialGrid {
+public:
+    static constexpr double DEFAULT_CELL_SIZE = 256.0;
+
+    explicit SpatialGrid(double cellSize = DEFAULT_CELL_SIZE);
+
+    // Inserts the id or moves it to new bounds.
+    void update(int id, const WorldRect& bounds);
+    void remove(int id);
+    void clear();
+
+    bool contains(int id) const;
+
+    // Ids whose bounds intersect the area, each once, in ascending order.
+    void query(const WorldRect& area, std::vector<int>& result) const;
+
+    size_t getObjectCount() const { return objectCount; }
+    size_t getOccupiedCellCount() const { return cells.size(); }
+
+private:
+    struct CellRange {
+        int64_t minX;
+        int64_t minY;
+        int64_t maxX;
+        int64_t maxY;
+
+        bool operator==(const CellRange& other) const {
+            return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+        }
+    };
+
+    struct Entry {
+        bool active{false};
+        WorldRect bounds{0.0, 0.0, 0.0, 0.0};
+        CellRange cells{0, 0, 0, 0};
+    };
+
+    double cellSize;
+    size_t objectCount;
+    std::vector<Entry> entries;
+    std::unordered_map<uint64_t, std::vector<int>> cells;
+
+    // Per-id stamp of the last query that reported it, to skip duplicates
+    // from objects spanning several cells.
+    mutable std::vector<uint32_t> queryStamps;
+    mutable uint32_t currentStamp;
+
+    static uint64_t cellKey(int64_t cellX, int64_t cellY);
+    CellRange cellRangeFor(const WorldRect& bounds) const;
+    void addToCells(int id, const CellRange& range);
+    void removeFromCells(int id, const CellRange& range);
+};
+
+#endif
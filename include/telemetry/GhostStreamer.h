@@ -0,0 +1,85 @@
+#ifndef GHOSTSTREAMER_H
+#define GHOSTSTREAMER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/SpscQueue.h"
+#include "telemetry/TelemetryFrame.h"
+
+// Streams any number of telemetry recordings on one background thread. Each
+// ghost keeps at most readAhead decoded frames queued, so memory stays flat
+// no matter how long the recordings are, and the render thread only ever
+// pops frames that are already in memory.
+class GhostStreamer {
+public:
+    static constexpr size_t DEFAULT_READ_AHEAD = 256;
+
+    explicit GhostStreamer(size_t readAhead = DEFAULT_READ_AHEAD);
+    ~GhostStreamer();
+
+    GhostStreamer(const GhostStreamer&) = delete;
+    GhostStreamer& operator=(const GhostStreamer&) = delete;
+
+    // Ghosts must be added before start().
+    bool addGhost(const std::string& path);
+
+    void start();
+    void stop();
+
+    // Consumer side: advances every ghost to the last frame at or before time.
+    void advance(double time);
+    // Restarts every ghost from its last frame stamped at or before time,
+    // found by timestamp as in TelemetryReplay::findFrame.
+    void seek(double time);
+
+    size_t getGhostCount() const { return tracks.size(); }
+    bool hasFrame(size_t index) const { return tracks[index]->hasCurrent; }
+    const TelemetryFrame& getFrame(size_t index) const { return tracks[index]->current; }
+
+private:
+    struct GhostSample {
+        uint32_t generation;
+        TelemetryFrame frame;
+    };
+
+    struct Track {
+        explicit Track(size_t readAhead) : queue(readAhead) {}
+
+        FILE* file{nullptr};
+        long frameCount{0};
+        SpscQueue<GhostSample> queue;
+
+        std::atomic<uint32_t> requestedGeneration{0};
+        std::atomic<double> seekTime{0.0};
+
+        // Producer-owned.
+        uint32_t producerGeneration{0};
+        bool endOfFile{false};
+
+        // Consumer-owned.
+        uint32_t consumerGeneration{0};
+        TelemetryFrame current{};
+        bool hasCurrent{false};
+    };
+
+    size_t readAhead;
+    std::vector<std::unique_ptr<Track>> tracks;
+
+    std::thread worker;
+    std::atomic<bool> running;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+
+    void run();
+    bool fillTrack(Track& track);
+    static long findFrame(Track& track, double time);
+};
+
+#endif
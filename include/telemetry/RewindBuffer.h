@@ -0,0 +1,61 @@
+#ifndef REWINDBUFFER_H
+#define REWINDBUFFER_H
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "telemetry/TelemetryFrame.h"
+#include "vehicle/VehicleInput.h"
+
+class Car;
+
+// Rewind history for the live car: a full state keyframe every
+// keyframeInterval steps plus the inputs applied in between. Rewinding
+// restores the nearest earlier keyframe and re-simulates forward, so the
+// interval trades memory (fewer keyframes) against rewind latency (more
+// re-simulated steps). The oldest segments are dropped to stay within
+// memoryBudget bytes.
+class RewindBuffer {
+public:
+    static constexpr int DEFAULT_KEYFRAME_INTERVAL = 60;
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 16 * 1024 * 1024;
+
+    RewindBuffer(int keyframeInterval = DEFAULT_KEYFRAME_INTERVAL,
+                 size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    // Call once per step with the car state at the start of the step and the
+    // input about to be applied to it.
+    void record(const Car& car, const VehicleInput& input);
+
+    // Restores the car to the start of targetStep. Returns false when that
+    // step is no longer (or not yet) in the history.
+    bool rewindTo(Car& car, long targetStep);
+
+    void clear();
+
+    long getCurrentStep() const { return currentStep; }
+    long getOldestStep() const;
+    size_t getMemoryUsage() const { return memoryUsage; }
+
+    int getKeyframeInterval() const { return keyframeInterval; }
+    size_t getMemoryBudget() const { return memoryBudget; }
+
+private:
+    struct Segment {
+        long startStep;
+        TelemetryFrame keyframe;
+        std::vector<VehicleInput> inputs;
+    };
+
+    int keyframeInterval;
+    size_t memoryBudget;
+    size_t memoryUsage;
+    long currentStep;
+    std::deque<Segment> segments;
+
+    size_t segmentSize() const;
+    void enforceBudget();
+};
+
+#endif
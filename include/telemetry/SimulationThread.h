@@ -0,0 +1,89 @@
+#ifndef SIMULATIONTHREAD_H
+#define SIMULATIONTHREAD_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+#include "core/SpscQueue.h"
+#include "core/TripleBuffer.h"
+#include "telemetry/TelemetryFrame.h"
+#include "vehicle/VehicleInput.h"
+
+class Car;
+class RewindBuffer;
+class TelemetryRecorder;
+
+// Runs the live car on its own thread at a fixed real-time rate. Timestamped
+// input events flow in through a lock-free queue and the state after each
+// step's forces flows out through a triple buffer, so a slow present or vsync
+// wait on the render thread never delays a physics step. Each step applies
+// exactly the events that arrived before its scheduled time. step() can also
+// be called directly on builds without threads.
+class SimulationThread {
+public:
+    struct Snapshot {
+        TelemetryFrame frame;
+        long step;
+        // Bumped on every rewind so the renderer can reset derived views.
+        uint32_t rewindCount;
+        // Arrival time of the newest input event this state reflects, or 0.
+        double inputTime;
+    };
+
+    static constexpr size_t INPUT_QUEUE_SIZE = 1024;
+
+    // None of these are owned. After start() they belong to the simulation
+    // thread until stop().
+    SimulationThread(Car& car, RewindBuffer& rewind, TelemetryRecorder& recorder);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    void start();
+    void stop();
+    bool isRunning() const { return running; }
+
+    // Render-thread side. Events must be pushed in time order. Returns false
+    // if the queue is full.
+    bool pushInput(const InputEvent& event);
+
+    // Picks up the newest snapshot, returning false if nothing new was published.
+    bool pollSnapshot() { return snapshots.update(); }
+    const Snapshot& getSnapshot() const { return snapshots.read(); }
+
+    // Runs one step on the calling thread, applying events stamped at or
+    // before wallTime.
+    void step(double wallTime = std::numeric_limits<double>::infinity());
+
+    long getStepCount() const { return stepCount; }
+
+    // Clock shared by input timestamps and step scheduling.
+    static double clockSeconds();
+
+private:
+    Car& car;
+    RewindBuffer& rewind;
+    TelemetryRecorder& recorder;
+
+    SpscQueue<InputEvent> inputs;
+    TripleBuffer<Snapshot> snapshots;
+
+    // Simulation-thread owned.
+    VehicleInput heldInput;
+    double simTime;
+    double lastInputTime;
+    uint32_t rewindCount;
+    std::atomic<long> stepCount;
+
+    std::thread worker;
+    std::atomic<bool> running;
+
+    int applyInputs(double wallTime);
+    void rewindCar();
+    void run();
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef TELEMETRYFRAME_H
+#define TELEMETRYFRAME_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "vehicle/Engine.h"
+#include "vehicle/Gearbox.h"
+
+struct WheelTelemetry {
+    double pos_x;
+    double pos_y;
+    double wheelAngle;
+    double angular_position;
+    double angular_velocity;
+    double angular_acceleration;
+    double normalForce;
+    double gripLevel;
+    double previousSlipError;
+    double tcsInterference;
+    double previousAbsSlipError;
+    double absInterference;
+    double lastForce_x;
+    double lastForce_y;
+    double lastVelocity_x;
+    double lastVelocity_y;
+};
+
+// One fixed-size record per physics step. Frames are written back to back
+// after a TelemetryHeader so a recording can be memory-mapped and indexed
+// directly, with time strictly increasing from frame to frame.
+struct TelemetryFrame {
+    double time;
+
+    double pos_x;
+    double pos_y;
+    double velocity_x;
+    double velocity_y;
+    double acceleration_x;
+    double acceleration_y;
+    double forces_x;
+    double forces_y;
+
+    double angular_position;
+    double angular_velocity;
+    double angular_acceleration;
+    double angular_torque;
+
+    double steering_angle;
+    double targetThrottle;
+    double actualThrottle;
+    double targetBrake;
+    double actualBrake;
+    double targetSteering;
+    double actualSteering;
+
+    WheelTelemetry wheels[4];
+    Engine::State engine;
+    Gearbox::State gearbox;
+};
+
+struct TelemetryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t frameSize;
+    double timeStep;
+};
+
+namespace Telemetry {
+    constexpr char MAGIC[8] = {'C', 'A', 'R', 'T', 'L', 'M', 'T', '\0'};
+    constexpr uint32_t VERSION = 1;
+}
+
+static_assert(std::is_trivially_copyable<TelemetryFrame>::value, "TelemetryFrame must be mappable");
+static_assert(sizeof(TelemetryHeader) % alignof(TelemetryFrame) == 0, "frames must stay aligned after the header");
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef TELEMETRYRECORDER_H
+#define TELEMETRYRECORDER_H
+
+#include <cstdio>
+#include <string>
+
+#include "telemetry/TelemetryFrame.h"
+
+class Car;
+
+class TelemetryRecorder {
+public:
+    TelemetryRecorder();
+    ~TelemetryRecorder();
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    bool open(const std::string& path, double timeStep);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    void record(const Car& car, double time);
+    void record(const TelemetryFrame& frame);
+
+    size_t getFrameCount() const { return frameCount; }
+
+private:
+    FILE* file;
+    size_t frameCount;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef TELEMETRYREPLAY_H
+#define TELEMETRYREPLAY_H
+
+#include <string>
+
+#include "core/MappedFile.h"
+#include "telemetry/TelemetryFrame.h"
+
+// Plays back a memory-mapped recording. Frames are never copied out of the
+// mapping; seeking is a binary search over the frame timestamps.
+class TelemetryReplay {
+public:
+    TelemetryReplay();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return frameCount > 0; }
+
+    size_t getFrameCount() const { return frameCount; }
+    const TelemetryFrame& getFrame(size_t index) const { return frames[index]; }
+    size_t findFrame(double time) const;
+
+    double getStartTime() const;
+    double getEndTime() const;
+    double getTimeStep() const;
+
+    void update(double realTimeInterval);
+    void seek(double time);
+    void seekRelative(double offset);
+    void stepFrames(int count);
+
+    void setSpeed(double speed);
+    double getSpeed() const { return speed; }
+
+    void togglePause();
+    void setPaused(bool paused) { this->paused = paused; }
+    bool isPaused() const { return paused; }
+
+    double getTime() const { return playhead; }
+    size_t getCurrentIndex() const { return currentIndex; }
+    const TelemetryFrame& getCurrentFrame() const { return frames[currentIndex]; }
+
+private:
+    MappedFile file;
+    const TelemetryHeader* header;
+    const TelemetryFrame* frames;
+    size_t frameCount;
+
+    double playhead;
+    double speed;
+    bool paused;
+    size_t currentIndex;
+};
+
+#endif
@@ -2,9 +2,10 @@
 #define DIAL_H
 
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
 #include <string>
-#include <map>
+#include "ui/HudText.h"
+
+class TextRenderer;
 
 class Dial {
 public:
@@ -12,7 +13,17 @@ public:
     ~Dial();
 
     void setValue(double value);
-    void draw(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font = nullptr);
+    // Reformats the numeric readout from the smoothed value.
+    void refreshReadout();
+    void draw(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text = nullptr);
+    // Static face (ticks, numbers, label, unit) and the parts that move
+    // (needle, readout); draw() is both.
+    void drawFace(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text = nullptr);
+    void drawDynamic(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text = nullptr);
+    // Changes whenever drawDynamic() would draw something different.
+    uint64_t getDynamicSignature(int radius) const;
+    // Area covered by the dial when drawn at the given size.
+    static SDL_Rect bounds(int centerX, int centerY, int radius);
 
 private:
     double minValue;
@@ -21,6 +32,7 @@ private:
     double displayValue;
     std::string label;
     std::string unit;
+    HudText readout;
 
     double startAngle;
     double endAngle;
@@ -28,25 +40,18 @@ private:
 
     SDL_Texture* backgroundTexture;
     int cachedRadius;
-    SDL_Texture* labelTexture;
-    int labelWidth, labelHeight;
-    SDL_Texture* unitTexture;
-    int unitWidth, unitHeight;
-    std::map<std::string, SDL_Texture*> valueCache;
-    std::string lastValueText;
-
-    void renderBackground(SDL_Renderer* renderer, int radius, TTF_Font* font);
+
+    void renderBackground(SDL_Renderer* renderer, int radius, TextRenderer* text);
     void drawArc(SDL_Renderer* renderer, int centerX, int centerY, int radius,
                  double startAngle, double endAngle, int segments = 64);
     void drawTicks(SDL_Renderer* renderer, int centerX, int centerY, int radius);
-    void drawNumbers(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font);
+    void drawNumbers(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text);
     void drawNeedle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
-    void drawLabel(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font);
-    void drawReadout(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font);
+    void drawLabel(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text);
+    void drawReadout(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text);
+    void drawUnit(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text);
 
-    void drawText(SDL_Renderer* renderer, const std::string& text, int x, int y,
-                  SDL_Color color, TTF_Font* font);
-    double valueToAngle(double value);
+    double valueToAngle(double value) const;
     double lerp(double a, double b, double t);
     void clearCache();
 };
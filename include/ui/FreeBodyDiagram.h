@@ -6,6 +6,7 @@
 #include <string>
 #include <map>
 #include "vehicle/Car.h"
+#include "ui/TextRenderer.h"
 
 class FreeBodyDiagram {
 public:
@@ -21,6 +22,7 @@ public:
 
 private:
     TTF_Font* font;
+    TextRenderer text;
     bool visible;
     int fontSize;
 
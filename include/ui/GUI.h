@@ -5,10 +5,12 @@
 #include <SDL2/SDL_ttf.h>
 #include <string>
 #include <vector>
-#include <map>
 #include "vehicle/Car.h"
 #include "ui/Graph.h"
 #include "ui/Dial.h"
+#include "ui/HudCompositor.h"
+#include "ui/HudText.h"
+#include "ui/TextRenderer.h"
 
 class GUI {
 public:
@@ -20,6 +22,19 @@ public:
     void drawHUD(SDL_Renderer* renderer, const Car& car, double throttle);
 
     void updateGraphs(const Car& car, double throttle, double brake, double steering);
+    void clearGraphs();
+    // Scales the time span shown by every graph, e.g. 2.0 zooms out.
+    void zoomGraphs(double factor);
+
+    // How often numeric HUD text is reformatted; <= 0 reformats every frame.
+    void setHudRefreshRate(double hz);
+
+    // Time from an input event to the present of the first frame showing it.
+    void recordInputLatency(double seconds);
+
+    void drawReplayTimeline(SDL_Renderer* renderer, double time, double startTime, double endTime,
+                            double speed, bool paused);
+    bool getReplayTimelineFraction(int mouseX, int mouseY, double& fraction) const;
 
     void drawText(SDL_Renderer* renderer, const std::string& text, int x, int y,
                   SDL_Color color = {255, 255, 255, 255});
@@ -34,6 +49,28 @@ public:
     bool areDialsVisible() const { return showDials; }
 
 private:
+    // The HUD is drawn in two passes: static chrome into the compositor's
+    // chrome layer, then dynamic widgets into their regions.
+    enum HudPass {
+        CHROME_PASS,
+        DYNAMIC_PASS
+    };
+
+    // Compositor region ids for the dynamic widgets.
+    enum HudRegion {
+        SPEED_REGION,
+        GEAR_REGION,
+        LATENCY_REGION,
+        TCS_REGION,
+        ABS_REGION,
+        THROTTLE_REGION,
+        STEERING_REGION,
+        BRAKE_REGION,
+        CLUTCH_REGION,
+        DIAL_REGION,
+        GRAPH_REGION = DIAL_REGION + 8
+    };
+
     TTF_Font* font;
     TTF_Font* dialFont;
     bool visible;
@@ -41,19 +78,31 @@ private:
     bool showDials;
     int fontSize;
 
-    struct TextCacheEntry {
-        SDL_Texture* texture;
-        int width;
-        int height;
-    };
-    std::map<std::string, TextCacheEntry> textCache;
-    void clearTextCache();
+    TextRenderer text;
+    TextRenderer dialText;
 
     double currentThrottle;
     double currentBrake;
     double currentSteering;
     double currentClutch;
 
+    SDL_Rect replayTimelineRect;
+
+    Uint32 hudRefreshInterval;
+    Uint32 lastHudRefresh;
+    Uint32 lastReplayRefresh;
+    HudText speedLine;
+    HudText gearLine;
+    int shownGear;
+    HudText latencyLine;
+    HudText replayLine;
+
+    static constexpr size_t LATENCY_WINDOW = 64;
+    double latencySamples[LATENCY_WINDOW];
+    size_t latencyCount;
+
+    HudCompositor compositor;
+
     std::vector<Graph> graphs;
     Dial rpmDial;
     Dial torqueDial;
@@ -64,15 +113,17 @@ private:
     Dial afrDial;
     Dial powerDial;
 
-    std::vector<std::string> formatCarStats(const Car& car, double throttle);
+    bool refreshDue(Uint32& lastRefresh) const;
+    void refreshHudText(const Car& car);
 
-    void drawGraphs(SDL_Renderer* renderer);
-    void drawDials(SDL_Renderer* renderer, const Car& car);
-    void drawInputSliders(SDL_Renderer* renderer);
+    void drawSpeedPanel(SDL_Renderer* renderer, const Car& car, HudPass pass);
+    void drawGraphs(SDL_Renderer* renderer, HudPass pass);
+    void drawDials(SDL_Renderer* renderer, const Car& car, HudPass pass);
+    void drawInputSliders(SDL_Renderer* renderer, HudPass pass);
 
     void calculateSystemInterference(const Car& car, double& maxTcs, double& maxAbs);
     void drawAssistIndicators(SDL_Renderer* renderer, int x, int y,
-                              double maxTcs, double maxAbs, int barWidth);
+                              double maxTcs, double maxAbs, int barWidth, HudPass pass);
 };
 
 #endif
@@ -2,25 +2,85 @@
 #define GRAPH_H
 
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
+#include <cstdint>
 #include <string>
-#include <deque>
 
+#include "config/UIConstants.h"
+#include "ui/HudText.h"
+#include "ui/MinMaxPyramid.h"
+
+class TextRenderer;
+
+// Scrolling graph. Samples go into a min/max pyramid and each pixel column
+// shows the envelope of the samples it covers, so zooming out to hours of
+// history keeps spikes visible instead of aliasing them away. The plot lives
+// in a target texture used as a ring buffer over pixel columns: each frame
+// only the columns touched since the last frame are drawn, and the texture is
+// presented in two copies split at the ring head. The panel, zero line and
+// label are cached in a second texture, so per-frame cost does not depend on
+// history length or zoom.
 class Graph {
 public:
-    Graph(const std::string& label, SDL_Color color, double minValue, double maxValue, size_t maxPoints = 150);
+    Graph(const std::string& label, SDL_Color color, double minValue, double maxValue, size_t visibleSamples = UIConstants::GRAPH_HISTORY_POINTS);
+    ~Graph();
+
+    Graph(Graph&& other) noexcept;
+    Graph& operator=(Graph&& other) noexcept;
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
 
     void addDataPoint(double value);
     void clear();
-    void render(SDL_Renderer* renderer, int x, int y, int width, int height, TTF_Font* font);
+    // Reformats the latest-value readout; the GUI calls this at the HUD rate.
+    void refreshReadout();
+    void render(SDL_Renderer* renderer, int x, int y, int width, int height, TextRenderer* text);
+
+    // render() in parts for the HUD compositor: prepare() updates the
+    // offscreen plot and must run outside any clip rect, renderChrome() draws
+    // the static panel and renderPlot() the curve and readout.
+    bool prepare(SDL_Renderer* renderer, int width, int height, TextRenderer* text);
+    void renderChrome(SDL_Renderer* renderer, int x, int y, int width, int height, TextRenderer* text);
+    void renderPlot(SDL_Renderer* renderer, int x, int y, int width, int height, TextRenderer* text);
+    // Changes whenever renderPlot() would draw something different.
+    uint64_t getRevision() const;
+
+    // Number of most recent samples spanning the graph width.
+    void setVisibleSamples(uint64_t samples);
+    uint64_t getVisibleSamples() const { return visibleSamples; }
 
 private:
-    std::deque<double> values;
+    MinMaxPyramid history;
     std::string label;
     SDL_Color color;
     double minValue;
     double maxValue;
-    size_t maxPoints;
+    uint64_t visibleSamples;
+    HudText readout;
+
+    // Last global pixel column drawn into plotTexture (-1 forces a full
+    // redraw) and the sample count at that time. That column may have been
+    // partial, so drawing resumes from it.
+    int64_t drawnColumn;
+    uint64_t drawnSamples;
+    uint64_t revision;
+
+    SDL_Renderer* cachedRenderer;
+    SDL_Texture* plotTexture;
+    SDL_Texture* chromeTexture;
+    int cachedWidth;
+    int cachedHeight;
+
+    void releaseTextures();
+    bool ensureTextures(SDL_Renderer* renderer, int width, int height, TextRenderer* text);
+    void drawChrome(SDL_Renderer* renderer, int width, int height, TextRenderer* text);
+    void drawNewColumns(SDL_Renderer* renderer);
+
+    int64_t columnForSample(uint64_t index) const;
+    uint64_t firstSampleOfColumn(int64_t column) const;
+    bool columnEnvelope(int64_t column, MinMaxPyramid::Bucket& envelope) const;
+    int64_t firstVisibleColumn(int64_t lastColumn) const;
+    int valueToY(double value) const;
+    void clearColumns(SDL_Renderer* renderer, int64_t fromPixel, int64_t toPixel);
 };
 
 #endif
@@ -0,0 +1,67 @@
+#ifndef HUDCOMPOSITOR_H
+#define HUDCOMPOSITOR_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+// Composites the HUD from two window-sized target textures. The chrome layer
+// holds everything static (panels, frames, labels, dial faces) and is only
+// redrawn when the layout changes. The HUD layer is the chrome plus the
+// dynamic widgets. Each widget owns a rectangle and a signature of what it
+// shows; a rectangle is restored from the chrome and redrawn only when its
+// signature changes. The HUD layer is presented with a single copy.
+//
+// Without render target support every frame falls back to drawing the chrome
+// and all widgets straight to the screen.
+class HudCompositor {
+public:
+    HudCompositor();
+    ~HudCompositor();
+
+    HudCompositor(const HudCompositor&) = delete;
+    HudCompositor& operator=(const HudCompositor&) = delete;
+
+    // Starts a frame. Returns true if the chrome must be drawn, between
+    // beginChrome() and endChrome(), before any region.
+    bool beginFrame(SDL_Renderer* renderer, int width, int height);
+    void beginChrome();
+    void endChrome();
+
+    // Returns true if the region must be redrawn. The chrome under it has
+    // then been restored and drawing is clipped to it until endRegion().
+    bool beginRegion(int id, const SDL_Rect& rect, uint64_t signature);
+    void endRegion();
+
+    // Draws the HUD layer to the target that was current at beginFrame().
+    void present();
+
+    // Forces the chrome and every region to be redrawn next frame.
+    void invalidate();
+
+    int getDirtyRegionCount() const { return dirtyRegions; }
+
+private:
+    struct Region {
+        SDL_Rect rect;
+        uint64_t signature;
+        bool valid;
+    };
+
+    SDL_Renderer* renderer;
+    SDL_Texture* chromeTexture;
+    SDL_Texture* layerTexture;
+    SDL_Texture* previousTarget;
+    int width;
+    int height;
+    bool chromeValid;
+    bool direct;
+    int dirtyRegions;
+    std::vector<Region> regions;
+
+    bool ensureTextures(SDL_Renderer* renderer, int width, int height);
+    void releaseTextures();
+    void restoreChrome(const SDL_Rect& rect);
+};
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef HUDTEXT_H
+#define HUDTEXT_H
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class TextRenderer;
+
+// One line of HUD text held in a fixed buffer. Text is rebuilt with
+// reset()/append*() and published with commit(), which never allocates and
+// reports whether the visible text changed. The laid-out glyph quads are kept
+// and only rebuilt when the text, position, colour or atlas changes.
+class HudText {
+public:
+    static constexpr size_t CAPACITY = 64;
+
+    HudText();
+
+    HudText& reset();
+    HudText& append(std::string_view text);
+    HudText& appendFixed(double value, int precision);
+    HudText& appendInt(long value);
+
+    // Publishes the text built since reset(). Returns true if it differs
+    // from the previously committed text.
+    bool commit();
+
+    std::string_view view() const { return std::string_view(shown, shownLength); }
+    // Incremented whenever commit() changes the text.
+    uint32_t getRevision() const { return revision; }
+
+    void draw(SDL_Renderer* renderer, TextRenderer& text, int x, int y, SDL_Color color);
+    void drawCentered(SDL_Renderer* renderer, TextRenderer& text, int centerX, int y, SDL_Color color);
+
+private:
+    char scratch[CAPACITY];
+    size_t scratchLength;
+    char shown[CAPACITY];
+    size_t shownLength;
+    uint32_t revision;
+
+    bool layoutValid;
+    int layoutX;
+    int layoutY;
+    int layoutWidth;
+    SDL_Color layoutColor;
+    const TextRenderer* layoutText;
+    uint32_t layoutAtlasVersion;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+};
+
+#endif
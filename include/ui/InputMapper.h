@@ -0,0 +1,44 @@
+#ifndef INPUTMAPPER_H
+#define INPUTMAPPER_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+#include "vehicle/VehicleInput.h"
+
+// Turns SDL keyboard and joystick events into timestamped InputEvents. Only
+// changes are emitted, so a held key or a resting axis costs nothing.
+//
+// Keyboard: W throttle, S brake, A/D steer, left shift clutch, E/C shift,
+// R rewind. Joystick: axis 0 steers, axes 5 and 4 (XInput triggers) are
+// throttle and brake, buttons 5/4 shift up/down and button 0 holds the clutch.
+class InputMapper {
+public:
+    static constexpr int STEERING_AXIS = 0;
+    static constexpr int THROTTLE_AXIS = 5;
+    static constexpr int BRAKE_AXIS = 4;
+    static constexpr int CLUTCH_BUTTON = 0;
+    static constexpr int SHIFT_DOWN_BUTTON = 4;
+    static constexpr int SHIFT_UP_BUTTON = 5;
+    static constexpr float AXIS_DEADZONE = 0.05f;
+
+    InputMapper();
+
+    // Appends the events caused by an SDL event that arrived at `time`;
+    // anything that is not driver input appends nothing.
+    void translate(const SDL_Event& event, double time, std::vector<InputEvent>& out);
+
+    // Converts an SDL event timestamp to SimulationThread::clockSeconds(),
+    // so time spent queued inside SDL counts toward latency.
+    static double arrivalTime(const SDL_Event& event);
+
+private:
+    bool leftKey;
+    bool rightKey;
+    float steering;
+
+    void emit(std::vector<InputEvent>& out, double time, InputEvent::Channel channel, float value);
+    void translateKey(SDL_Scancode scancode, bool pressed, double time, std::vector<InputEvent>& out);
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef MINMAXPYRAMID_H
+#define MINMAXPYRAMID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Multi-resolution min/max history of a sample stream. Level 0 keeps raw
+// samples, and each bucket of level k summarizes FANOUT buckets of level k-1.
+// Every level is a ring of `capacity` buckets, so memory is fixed while the
+// time span covered grows geometrically with the level: the defaults hold
+// 2048 raw samples and about 9 hours of 1 kHz data at the coarsest level.
+//
+// Queries take the coarsest level whose buckets still fit inside the
+// requested range. The result is the true min/max of the range, widened by at
+// most one bucket on each side, so single-sample spikes are never dropped.
+class MinMaxPyramid {
+public:
+    struct Bucket {
+        double min;
+        double max;
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 2048;
+    static constexpr size_t DEFAULT_LEVELS = 8;
+    static constexpr size_t FANOUT = 4;
+
+    explicit MinMaxPyramid(size_t capacity = DEFAULT_CAPACITY, size_t levels = DEFAULT_LEVELS);
+
+    void append(double value);
+    void clear();
+
+    uint64_t getSampleCount() const { return sampleCount; }
+    // Oldest sample index still summarized by any level.
+    uint64_t getOldestSample() const;
+    double getLatest() const { return latest; }
+
+    // Envelope of samples [begin, end). Returns false if none of that range is
+    // retained.
+    bool query(uint64_t begin, uint64_t end, Bucket& result) const;
+
+    // Level a query spanning `span` samples would prefer before falling back
+    // to coarser levels for data that has aged out.
+    size_t levelForSpan(uint64_t span) const;
+
+    size_t getLevelCount() const { return levels.size(); }
+    size_t getCapacity() const { return capacity; }
+
+private:
+    struct Level {
+        std::vector<Bucket> ring;
+        uint64_t count{0};
+        Bucket pending{0.0, 0.0};
+        size_t pendingCount{0};
+        uint64_t bucketSize{1};
+    };
+
+    size_t capacity;
+    std::vector<Level> levels;
+    uint64_t sampleCount;
+    double latest;
+
+    void push(Level& level, const Bucket& bucket);
+    bool queryLevel(size_t index, uint64_t begin, uint64_t end, Bucket& result) const;
+};
+
+#endif
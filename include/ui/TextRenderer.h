@@ -0,0 +1,73 @@
+#ifndef TEXTRENDERER_H
+#define TEXTRENDERER_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Draws strings from a single glyph atlas. Every glyph the HUD can show is
+// rasterized once into one texture; a string becomes one SDL_RenderGeometry
+// call with a textured quad per character, tinted by vertex colour. Memory is
+// fixed no matter how many distinct strings are drawn.
+class TextRenderer {
+public:
+    TextRenderer();
+    ~TextRenderer();
+
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    // The font is not owned. Changing it drops the atlas.
+    void setFont(TTF_Font* font);
+    bool hasFont() const { return font != nullptr; }
+
+    void draw(SDL_Renderer* renderer, std::string_view text, int x, int y, SDL_Color color);
+    void drawCentered(SDL_Renderer* renderer, std::string_view text, int centerX, int y, SDL_Color color);
+
+    // Builds the quads for a string without drawing them, so callers can keep
+    // the geometry of text that rarely changes. Invalid once the atlas
+    // version changes.
+    bool layout(SDL_Renderer* renderer, std::string_view text, int x, int y, SDL_Color color,
+                std::vector<SDL_Vertex>& quadVertices, std::vector<int>& quadIndices);
+    void drawGeometry(SDL_Renderer* renderer, const std::vector<SDL_Vertex>& quadVertices,
+                      const std::vector<int>& quadIndices);
+    uint32_t getAtlasVersion() const { return atlasVersion; }
+
+    int measureWidth(std::string_view text) const;
+    int getLineHeight() const { return lineHeight; }
+
+    // Decodes one UTF-8 code point starting at index and advances past it.
+    // Malformed bytes decode as '?'.
+    static uint32_t nextCodePoint(std::string_view text, size_t& index);
+
+private:
+    struct Glyph {
+        SDL_Rect source;
+        int advance;
+    };
+
+    static constexpr uint32_t FIRST_ASCII = 32;
+    static constexpr uint32_t LAST_ASCII = 126;
+    static const uint32_t EXTRA_CODE_POINTS[];
+
+    TTF_Font* font;
+    SDL_Renderer* atlasRenderer;
+    SDL_Texture* atlas;
+    int atlasHeight;
+    int lineHeight;
+    uint32_t atlasVersion;
+
+    std::vector<uint32_t> codePoints;
+    std::vector<Glyph> glyphs;
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+    bool ensureAtlas(SDL_Renderer* renderer);
+    void destroyAtlas();
+    const Glyph* findGlyph(uint32_t codePoint) const;
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef ADAPTIVESTEPPER_H
+#define ADAPTIVESTEPPER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "config/PhysicsConstants.h"
+#include "telemetry/TelemetryFrame.h"
+#include "vehicle/VehicleInput.h"
+
+class Car;
+
+struct AdaptiveStepSettings {
+    // Allowed relative change per step between one full step and two halves.
+    double tolerance{1e-2};
+    double minStep{PhysicsConstants::TIME_INTERVAL / 8.0};
+    double maxStep{PhysicsConstants::TIME_INTERVAL * 8.0};
+    // Width a discrete event is narrowed to before the step across it is taken.
+    double eventTolerance{PhysicsConstants::TIME_INTERVAL / 8.0};
+};
+
+// Variable-timestep driver for headless runs. Each step is taken once at h
+// and again as two halves of h/2. The difference between the two estimates
+// the error. The halves are kept, and h grows on cruise and shrinks through
+// launches, lockups and spins. A step that changes the gear, clutch lock, or
+// ABS/TCS activity is bisected until the change is pinned to within
+// eventTolerance. The car must not be stepped by anything else meanwhile.
+class AdaptiveStepper {
+public:
+    enum EventKind : uint8_t {
+        GEAR_CHANGE,
+        CLUTCH_LOCK,
+        ABS_ACTIVITY,
+        TCS_ACTIVITY
+    };
+
+    struct Event {
+        // End of the step that crossed it.
+        double time;
+        EventKind kind;
+    };
+
+    explicit AdaptiveStepper(Car& car, const AdaptiveStepSettings& settings = AdaptiveStepSettings());
+
+    // Holds input for duration seconds. One-shot shifts apply at the start.
+    // The car's own time step is restored on return.
+    void advance(const VehicleInput& input, double duration);
+
+    double getTime() const { return time; }
+    double getStepSize() const { return stepSize; }
+    long getAcceptedSteps() const { return acceptedSteps; }
+    long getRejectedSteps() const { return rejectedSteps; }
+    // Car::step calls so far, accepted or not.
+    long getEvaluations() const { return evaluations; }
+    const std::vector<Event>& getEvents() const { return events; }
+
+private:
+    struct DiscreteState {
+        int gear;
+        bool clutchLocked;
+        uint8_t absActive;
+        uint8_t tcsActive;
+
+        bool operator==(const DiscreteState& other) const {
+            return gear == other.gear && clutchLocked == other.clutchLocked &&
+                   absActive == other.absActive && tcsActive == other.tcsActive;
+        }
+    };
+
+    Car& car;
+    AdaptiveStepSettings settings;
+
+    double time{0.0};
+    double stepSize;
+    long acceptedSteps{0};
+    long rejectedSteps{0};
+    long evaluations{0};
+    std::vector<Event> events;
+
+    DiscreteState discreteState() const;
+    void logEvents(const DiscreteState& before, const DiscreteState& after);
+    void stepCar(const VehicleInput& input, double dt);
+    double errorNorm(const TelemetryFrame& full, const TelemetryFrame& halves) const;
+};
+
+#endif
@@ -4,16 +4,26 @@
 #include <SDL_render.h>
 #include <Eigen/Core>
 
+#include <algorithm>
+#include <array>
+
+#include "core/MultiRateScheduler.h"
 #include "core/RigidBody.h"
 #include "vehicle/Wheel.h"
 #include "vehicle/Engine.h"
 #include "vehicle/Gearbox.h"
+#include "vehicle/SteeringGeometry.h"
 #include "control/TractionControl.h"
 #include "control/AntiLockBrakes.h"
+#include "telemetry/TelemetryFrame.h"
+#include "vehicle/VehicleInput.h"
+#include "vehicle/VehicleParams.h"
+#include "rendering/RenderBatch.h"
+#include "rendering/Camera.h"
 
 class Car : public RigidBody {
     public:
-        Car(double x, double y, int w, int h);
+        Car(double x, double y, int w, int h, const VehicleParams& params = VehicleParams());
         ~Car();
 
         double steering_angle{0};
@@ -22,6 +32,7 @@ class Car : public RigidBody {
         double braking_power{PhysicsConstants::BRAKING_POWER};
 
         bool showDebugVectors{true};
+        Uint8 renderAlpha{255};
 
         double targetThrottle{0.0};
         double actualThrottle{0.0};
@@ -40,9 +51,13 @@ class Car : public RigidBody {
         const int getWidth();
         const int getHeight();
 
-        void drawCar(SDL_Renderer* renderer, const Camera* camera = nullptr);
-        void drawDebugVectors(SDL_Renderer* renderer, const Camera* camera = nullptr);
+        // Appends body, tires and debug vectors to the batch; nothing is drawn
+        // until the batch is flushed.
+        void drawCar(RenderBatch& batch, const Camera* camera = nullptr);
+        void drawDebugVectors(RenderBatch& batch, const Camera* camera = nullptr);
         void eraseCar(SDL_Renderer *renderer);
+        // World-space box covering everything drawCar draws, for culling.
+        WorldRect getRenderBounds() const;
 
         double getAngleToWheel(Wheel *wheel);
 
@@ -56,6 +71,46 @@ class Car : public RigidBody {
         void setSteering(double steering);
         void updateInputs(double timeInterval);
 
+        void applyInput(const VehicleInput& input);
+        void computeForces();
+        void integrate();
+        void step(const VehicleInput& input);
+
+        // Physics step length. Defaults to TIME_INTERVAL, which recordings
+        // and the live loop assume; headless runs may use a longer step.
+        void setTimeStep(double dt) { timeStep = dt; }
+        double getTimeStep() const { return timeStep; }
+
+        // Spins the wheels, brakes and clutch/TCS in n substeps of each step
+        // against the chassis held where the step started; the chassis still
+        // integrates once. Not used by multi-rate cars, whose wheel rate
+        // already sets this.
+        void setWheelSubsteps(int n) { wheelSubsteps = std::max(1, n); }
+        int getWheelSubsteps() const { return wheelSubsteps; }
+
+        // Multi-rate stepping. Once set, step() runs the wheels, clutch and
+        // TCS/ABS at wheelRate and the chassis and load transfer at
+        // chassisRate, instead of everything once per timeStep. Rates should
+        // divide 1 / timeStep so no partial interval is left between steps.
+        void setSubsystemRates(double wheelRate, double chassisRate);
+        bool isMultiRate() const { return multiRate; }
+        // Advances the subsystems by timeStep.
+        void stepSubsystems();
+
+        // Wheel half: spins the wheels against the chassis extrapolated from
+        // its last step and accumulates their tire forces.
+        void stepWheels(double dt);
+        // Chassis half: integrates the tire forces averaged since the last
+        // chassis step.
+        void stepChassis(double dt);
+
+        // Chassis half of integrate(). Schemes with more than one evaluation
+        // re-evaluate the tire forces at each stage, with wheel spin held.
+        template <typename Integrator>
+        void integrateChassis(double time_interval);
+        // Net tire force (world x, y) and yaw torque for a chassis state.
+        Eigen::Vector3d evaluateTireLoad(double angle, const Eigen::Vector3d& chassisVelocity) const;
+
         void shiftUp();
         void shiftDown();
         void holdClutch();
@@ -66,7 +121,12 @@ class Car : public RigidBody {
 
         const Engine& getEngine() const;
         const Gearbox& getGearbox() const;
+        const VehicleParams& getParams() const { return params; }
 
+        TelemetryFrame captureTelemetry(double time) const;
+        void applyTelemetry(const TelemetryFrame& frame);
+
+        // Reads the wheel loads as they stand; call updateLoadTransfer() first.
         void sumWheelForces();
         void moveWheels();
         void updateLoadTransfer();
@@ -74,16 +134,52 @@ class Car : public RigidBody {
     private:
         const double width;
         const double height;
-        SDL_Texture* carTexture{nullptr};
+
+        const VehicleParams params;
+        // Shared by all four wheels, for evaluating them together.
+        const TireModel<double> tireModel;
+        const SteeringGeometry<double> steeringGeometry;
+        double timeStep{PhysicsConstants::TIME_INTERVAL};
+
+        int wheelSubsteps{1};
+
+        bool multiRate{false};
+        MultiRateScheduler subsystems;
+        double chassisPeriod{0.0};
+        // Wheel time since the last chassis step, which the chassis state is
+        // extrapolated over, and the tire impulses gathered meanwhile.
+        double chassisElapsed{0.0};
+        std::array<Eigen::Vector2d, 4> tireImpulse;
+        double yawImpulse{0.0};
+
+        int forceDebugCounter{0};
+        int engineDebugCounter{0};
 
         Engine engine;
         Gearbox gearbox;
         TractionControl tcs;
         AntiLockBrakes abs;
 
-        SDL_Texture* getRectangleTexture(SDL_Renderer *renderer);
-
+        // Sets the front wheels' Ackermann angles for steering_angle.
+        void steerFrontWheels();
+        void applyBrakes(double dt);
+        void updateEngine(double throttle, double dt);
+        // One wheel substep: brakes/ABS, clutch/TCS and tire friction, then
+        // the wheel spin, with the tire impulses accumulated for the chassis.
+        void spinWheels(double dt);
+        void applyTireImpulse(double interval);
+        void resetChassisInterval();
+        double tireResponseTime(double dt) const;
+
+        // Tire forces on all four wheels in one pass, from each wheel's
+        // contact velocity in the car's frame.
+        TireModel<double>::LaneForces<4> evaluateTires(const std::array<Eigen::Vector2d, 4>& velocityLocal,
+                                                       double dt) const;
+
+        double contactAngle() const;
         Eigen::Vector2d calculateWheelVelocityLocal(Eigen::Vector2d wheelPosition);
+        static Eigen::Vector2d wheelVelocityLocal(const Eigen::Vector2d& wheelPosition, double angle,
+                                                  const Eigen::Vector3d& chassisVelocity);
 };
 
 #endif
@@ -2,12 +2,23 @@
 #ifndef SIMPLETRAFFICGAME_ENGINE_H
 #define SIMPLETRAFFICGAME_ENGINE_H
 
-#endif
-
+#include "vehicle/VehicleParams.h"
 
 class Engine
 {
+public:
+    struct State {
+        double rpm;
+        double loadTorque;
+        double engineTorque;
+        double currentPower;
+        double currentVolumetricEfficiency;
+        double currentAirFlowRate;
+    };
+
 private:
+    EngineParams params;
+
     double rpm{1000};
     double loadTorque{0};
     double engineTorque{0};
@@ -21,7 +32,13 @@ private:
 
 
 public:
-    void updateRPM(double throttle, double effectiveInertia);
+    Engine() = default;
+    explicit Engine(const EngineParams& params);
+
+    const EngineParams& getParams() const { return params; }
+
+    // Friction is taken implicitly, so large dt can't reverse the engine.
+    void updateRPM(double throttle, double effectiveInertia, double dt);
     double getRPM() const;
     double calculateTorque(double throttle);
     void addLoadTorque(double torque);
@@ -33,4 +50,9 @@ public:
     double getVolumetricEfficiencyValue() const;
     double getAirFlowRateValue() const;
     double getPowerGeneratedValue(double throttle) const;
-};
\ No newline at end of file
+
+    State getState() const;
+    void setState(const State& state);
+};
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "vehicle/FleetKernels.h"
+#include "vehicle/SteeringGeometry.h"
+#include "vehicle/TireModel.h"
+#include "vehicle/VehicleParams.h"
+
+// Many identical cars stepped together for throughput (traffic, batch
+// experiments), with state in structure-of-arrays columns so each phase of the
+// step runs down contiguous, aligned memory. Scalar is float or double; the
+// double instance is the reference the float one is validated against.
+//
+// The model is Car's chassis, load transfer, Ackermann steering and tires, with
+// the powertrain reduced to a fixed first-gear drive torque on the rear wheels
+// and brakes that bring a wheel to rest without reversing it. No TCS or ABS.
+// What that leaves out of Car, to keep a car's step a few arithmetic passes:
+//  - the engine, clutch and gearbox: the drive is the clutch's full torque in
+//    first, which tracks a full-throttle Car launch, but there is no engine
+//    braking off the throttle and no upshifts;
+//  - a braked wheel that reaches rest is held locked, where Car's brake
+//    releases it for a step, so hard stops are shorter;
+//  - Car's input rate limits and speed-dependent steering: inputs apply as
+//    given.
+// FleetTest bounds the double fleet against Car through a weaving launch.
+//
+// Positions are in meters, y up (the frame of Car::velocity, not pixels). Each
+// car keeps a double origin and a Scalar offset from it; with the floating
+// origin on, the offset is folded into the origin once it passes
+// REBASE_DISTANCE, so float cars keep centimeter precision far from zero.
+//
+// The per-car work runs in FleetKernels picked for this CPU at startup; the
+// scalar kernels are the reference the SIMD ones are tested against.
+template <typename Scalar>
+class Fleet {
+public:
+    static constexpr double REBASE_DISTANCE = 256.0;
+
+    struct Input {
+        Scalar throttle{0};
+        Scalar brake{0};
+        // Steering wheel angle in radians, as Car::steering_angle.
+        Scalar steering{0};
+    };
+
+    explicit Fleet(const VehicleParams& params = VehicleParams());
+
+    // Call before placing any cars. Off, positions are held in Scalar alone.
+    void setFloatingOrigin(bool enabled) { floatingOrigin = enabled; }
+
+    void setKernels(const FleetKernels<Scalar>& kernels) { this->kernels = &kernels; }
+    const char* getKernelName() const { return kernels->name; }
+
+    // Adds a car at rest and returns its index.
+    int place(double x, double y, double heading = 0.0);
+    void setInput(int car, const Input& input);
+
+    void step(double dt);
+
+    size_t size() const { return count; }
+    Eigen::Vector2d getPosition(int car) const;
+    Eigen::Vector2d getVelocity(int car) const;
+    double getHeading(int car) const { return heading[car]; }
+    double getYawRate(int car) const { return yawRate[car]; }
+    double getWheelSpeed(int car, int wheel) const { return omega[wheel][car]; }
+
+private:
+    using Column = std::vector<Scalar, Eigen::aligned_allocator<Scalar>>;
+
+    // FL, FR, RL, RR as in Car.
+    static constexpr int WHEELS = FleetState<Scalar>::WHEELS;
+
+    // The fleet-wide part of the kernels' state; state() adds the columns.
+    FleetState<Scalar> constants;
+    SteeringGeometry<Scalar> steeringGeometry;
+    Scalar maxSteeringAngle;
+    bool floatingOrigin{true};
+    const FleetKernels<Scalar>* kernels;
+    size_t count{0};
+
+    // Columns are padded to a multiple of FLEET_LANE_PADDING.
+    std::vector<double> originX;
+    std::vector<double> originY;
+    Column posX;
+    Column posY;
+    Column velX;
+    Column velY;
+    Column accelX;
+    Column accelY;
+    Column heading;
+    Column yawRate;
+    Column yawAccel;
+    std::array<Column, WHEELS> omega;
+
+    Column throttle;
+    Column brake;
+    Column steering;
+    std::array<Column, WHEELS> wheelAngle;
+
+    // Per-step scratch.
+    Column cosHeading;
+    Column sinHeading;
+    std::array<Column, WHEELS> normalForce;
+    Column forceX;
+    Column forceY;
+    Column torque;
+
+    void resize(size_t columns);
+    FleetState<Scalar> state();
+    void steer();
+    void rebase();
+};
+
+extern template class Fleet<float>;
+extern template class Fleet<double>;
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef FLEETKERNELLANES_H
+#define FLEETKERNELLANES_H
+
+#include <Eigen/Core>
+
+#include "core/FastMath.h"
+#include "vehicle/FleetKernels.h"
+#include "vehicle/TireModel.h"
+
+// Fleet step kernels that run N cars per pass in SIMD lanes. Each file in
+// src/vehicle/simd/ compiles them for one instruction set, and the dispatcher
+// in FleetKernels.cpp picks among them at startup.
+//
+// The same Eigen templates are instantiated in every one of those files with
+// different instruction sets enabled, so none of that code may be shared at
+// link time: a generic caller could otherwise land in a copy built for AVX.
+// Isa is a tag type from an anonymous namespace, which gives every kernel
+// internal linkage, and the kernels are flattened so the Eigen and TireModel
+// code they call is inlined into them rather than emitted out of line.
+// Flattening needs the optimizer, so the build compiles these files at -O2
+// in every configuration, and the FleetSimdKernelsExportOnlyKernelTables test
+// checks their objects define no code symbols.
+
+#if defined(__GNUC__)
+#define FLEET_KERNEL __attribute__((flatten))
+#else
+#define FLEET_KERNEL
+#endif
+
+template <typename Isa, typename Scalar, int N>
+struct FleetKernelLanes {
+    static_assert(FLEET_LANE_PADDING % N == 0, "lane width must divide the column padding");
+
+    using Lanes = typename TireModel<Scalar>::template Lanes<N>;
+    using Column = Eigen::Map<Lanes>;
+    using ConstColumn = Eigen::Map<const Lanes>;
+
+    static FLEET_KERNEL void transferLoad(FleetState<Scalar>& s) {
+        const Scalar weight = s.mass * Scalar(9.81);
+        const Scalar frontNominal = weight * s.frontWeightBias / Scalar(2);
+        const Scalar rearNominal = weight * (Scalar(1) - s.frontWeightBias) / Scalar(2);
+        const Scalar minLoad = Scalar(FLEET_MIN_NORMAL_FORCE);
+
+        for (size_t i = 0; i < s.count; i += N) {
+            Lanes heading = ConstColumn(s.heading + i);
+            Lanes cosAngle = PhysicsMath::cos(heading);
+            Lanes sinAngle = PhysicsMath::sin(heading);
+            Column(s.cosHeading + i) = cosAngle;
+            Column(s.sinHeading + i) = sinAngle;
+
+            Lanes ax = ConstColumn(s.accelX + i);
+            Lanes ay = ConstColumn(s.accelY + i);
+            Lanes axLocal = ax * cosAngle - ay * sinAngle;
+            Lanes ayLocal = ax * sinAngle + ay * cosAngle;
+
+            Lanes longitudinal = -s.mass * ayLocal * s.cgHeight / s.wheelbase;
+            Lanes lateral = -s.mass * axLocal * s.cgHeight / s.trackWidth;
+
+            Column(s.normalForce[0] + i) = (frontNominal + longitudinal - lateral).max(minLoad);
+            Column(s.normalForce[1] + i) = (frontNominal + longitudinal + lateral).max(minLoad);
+            Column(s.normalForce[2] + i) = (rearNominal - longitudinal - lateral).max(minLoad);
+            Column(s.normalForce[3] + i) = (rearNominal - longitudinal + lateral).max(minLoad);
+        }
+    }
+
+    static FLEET_KERNEL void applyTires(FleetState<Scalar>& s, Scalar dt) {
+        const Lanes zero = Lanes::Zero();
+        const Scalar stopOmega = Scalar(FLEET_BRAKE_STOP_OMEGA);
+
+        for (size_t i = 0; i < s.count; i += N) {
+            Lanes cosAngle = ConstColumn(s.cosHeading + i);
+            Lanes sinAngle = ConstColumn(s.sinHeading + i);
+            Lanes velX = ConstColumn(s.velX + i);
+            Lanes velY = ConstColumn(s.velY + i);
+            Lanes yawRate = ConstColumn(s.yawRate + i);
+            Lanes throttle = ConstColumn(s.throttle + i);
+            Lanes brake = ConstColumn(s.brake + i);
+
+            Lanes forwardX = velX * cosAngle - velY * sinAngle;
+            Lanes forwardY = velX * sinAngle + velY * cosAngle;
+
+            Lanes forceX = zero;
+            Lanes forceY = zero;
+            Lanes torque = zero;
+            for (int w = 0; w < FleetState<Scalar>::WHEELS; w++) {
+                const Scalar px = s.wheelX[w];
+                const Scalar py = s.wheelY[w];
+
+                Lanes spin = ConstColumn(s.omega[w] + i);
+                typename TireModel<Scalar>::template LaneForces<N> f = s.tire.template evaluateLanes<N>(
+                    ConstColumn(s.wheelAngle[w] + i), forwardX - yawRate * py, forwardY + yawRate * px,
+                    spin, ConstColumn(s.normalForce[w] + i), dt);
+
+                forceX += f.x * cosAngle + f.y * sinAngle;
+                forceY += -f.x * sinAngle + f.y * cosAngle;
+                torque += px * f.y - py * f.x;
+
+                Lanes wheelTorque = -f.frictionTorque;
+                if (w >= 2) {
+                    wheelTorque += (spin * s.tire.radius < s.topSpeed).select(throttle * s.driveTorque, zero);
+                }
+                auto braking = brake > Scalar(0);
+                auto moving = spin.abs() >= stopOmega;
+                Lanes brakeTorque = brake * s.brakeTorque;
+                wheelTorque -= (braking && moving).select((spin > Scalar(0)).select(brakeTorque, -brakeTorque), zero);
+
+                Lanes next = spin + wheelTorque / s.tire.momentOfInertia * dt;
+                Column(s.omega[w] + i) = (braking && (!moving || next * spin < Scalar(0))).select(zero, next);
+            }
+            Column(s.forceX + i) = forceX;
+            Column(s.forceY + i) = forceY;
+            Column(s.torque + i) = torque;
+        }
+    }
+
+    static FLEET_KERNEL void integrateChassis(FleetState<Scalar>& s, Scalar dt) {
+        const Scalar twoPi = Scalar(2.0 * M_PI);
+        const Scalar halfDt2 = Scalar(0.5) * dt * dt;
+
+        for (size_t i = 0; i < s.count; i += N) {
+            Lanes accelX = ConstColumn(s.forceX + i) / s.mass;
+            Lanes accelY = ConstColumn(s.forceY + i) / s.mass;
+            Lanes yawAccel = ConstColumn(s.torque + i) / s.yawInertia;
+            Lanes velX = ConstColumn(s.velX + i);
+            Lanes velY = ConstColumn(s.velY + i);
+            Lanes yawRate = ConstColumn(s.yawRate + i);
+
+            Column(s.posX + i) += velX * dt + accelX * halfDt2;
+            Column(s.posY + i) += velY * dt + accelY * halfDt2;
+            // std::remainder without the libm call.
+            Lanes heading = ConstColumn(s.heading + i) + yawRate * dt + yawAccel * halfDt2;
+            Column(s.heading + i) = heading - twoPi * (heading / twoPi).round();
+
+            Column(s.velX + i) = velX + accelX * dt;
+            Column(s.velY + i) = velY + accelY * dt;
+            Column(s.yawRate + i) = yawRate + yawAccel * dt;
+            Column(s.accelX + i) = accelX;
+            Column(s.accelY + i) = accelY;
+            Column(s.yawAccel + i) = yawAccel;
+        }
+    }
+
+    static constexpr FleetKernels<Scalar> kernels(const char* name) {
+        return {name, &transferLoad, &applyTires, &integrateChassis};
+    }
+};
+
+// One instruction set's kernels for both scalar types.
+struct FleetKernelSet {
+    FleetKernels<float> singlePrecision;
+    FleetKernels<double> doublePrecision;
+
+    template <typename Scalar>
+    const FleetKernels<Scalar>& get() const;
+};
+
+template <>
+inline const FleetKernels<float>& FleetKernelSet::get<float>() const { return singlePrecision; }
+template <>
+inline const FleetKernels<double>& FleetKernelSet::get<double>() const { return doublePrecision; }
+
+// Defined in src/vehicle/simd/ when CARPHYS_SIMD_DISPATCH is set.
+extern const FleetKernelSet FLEET_KERNELS_SSE42;
+extern const FleetKernelSet FLEET_KERNELS_AVX2;
+extern const FleetKernelSet FLEET_KERNELS_AVX512;
+
+#endif
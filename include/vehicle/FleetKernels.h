@@ -0,0 +1,87 @@
+#ifndef FLEETKERNELS_H
+#define FLEETKERNELS_H
+
+#include <cstddef>
+#include <vector>
+
+#include "vehicle/TireModel.h"
+
+// The columns and constants of a Fleet that its step kernels work on. Columns
+// hold `count` cars, a multiple of FLEET_LANE_PADDING so the widest kernel
+// never needs a scalar tail; the padding cars sit at rest.
+template <typename Scalar>
+struct FleetState {
+    static constexpr int WHEELS = 4;
+
+    size_t count;
+
+    TireModel<Scalar> tire;
+    Scalar wheelX[WHEELS];
+    Scalar wheelY[WHEELS];
+    Scalar mass;
+    Scalar yawInertia;
+    Scalar wheelbase;
+    Scalar trackWidth;
+    Scalar cgHeight;
+    Scalar frontWeightBias;
+    Scalar driveTorque;
+    Scalar brakeTorque;
+    Scalar topSpeed;
+
+    Scalar* posX;
+    Scalar* posY;
+    Scalar* velX;
+    Scalar* velY;
+    Scalar* accelX;
+    Scalar* accelY;
+    Scalar* heading;
+    Scalar* yawRate;
+    Scalar* yawAccel;
+    Scalar* omega[WHEELS];
+    const Scalar* throttle;
+    const Scalar* brake;
+    const Scalar* wheelAngle[WHEELS];
+
+    // Per-step scratch.
+    Scalar* cosHeading;
+    Scalar* sinHeading;
+    Scalar* normalForce[WHEELS];
+    Scalar* forceX;
+    Scalar* forceY;
+    Scalar* torque;
+};
+
+constexpr size_t FLEET_LANE_PADDING = 16;
+
+// Floor on a tire's load, as in Car::updateLoadTransfer.
+constexpr double FLEET_MIN_NORMAL_FORCE = 60.0;
+// Below this spin a braked wheel is held at rest, as in AntiLockBrakes.
+constexpr double FLEET_BRAKE_STOP_OMEGA = 1e-3;
+
+// One implementation of the fleet step, built for one instruction set.
+template <typename Scalar>
+struct FleetKernels {
+    const char* name;
+    // Heading sin/cos and each tire's load from last step's acceleration.
+    void (*transferLoad)(FleetState<Scalar>& state);
+    // Contact velocities, tire forces and wheel spin, with the forces summed
+    // onto each car.
+    void (*applyTires)(FleetState<Scalar>& state, Scalar dt);
+    void (*integrateChassis)(FleetState<Scalar>& state, Scalar dt);
+};
+
+// Every kernel set this CPU can run, from the scalar reference to the widest.
+template <typename Scalar>
+std::vector<const FleetKernels<Scalar>*> supportedFleetKernels();
+
+// The named kernel set ("scalar", "sse4.2", "avx2", "avx512"), or null if it
+// wasn't built or this CPU can't run it.
+template <typename Scalar>
+const FleetKernels<Scalar>* findFleetKernels(const char* name);
+
+// The widest kernel set this CPU runs, chosen once per process. Setting
+// CARPHYS_SIMD to a kernel name forces that set instead, for testing.
+template <typename Scalar>
+const FleetKernels<Scalar>& selectFleetKernels();
+
+#endif
@@ -3,9 +3,23 @@
 
 #include <vector>
 
+#include "vehicle/VehicleParams.h"
+
 class Engine;
 
 class Gearbox {
+public:
+    struct State {
+        int selectedGear;
+        int clutchPressed;
+        double clutchEngagement;
+        double loadTorque;
+        double engineTorque;
+        double clutchTorque;
+        double clutchSlip;
+        double heldTorque;
+    };
+
 private:
     int selectedGear;
     std::vector<double> gearRatios;
@@ -18,13 +32,26 @@ private:
     double clutchSlip;
     double heldTorque;
 
+    double clutchMaxTorque{PhysicsConstants::CLUTCH_MAX_TORQUE};
+    double clutchSlipK{PhysicsConstants::CLUTCH_SLIP_K};
+    double clutchLockThreshold{PhysicsConstants::CLUTCH_LOCK_THRESHOLD};
+
+    int callDebugCounter{0};
+    int clutchDebugCounter{0};
+
 public:
     Gearbox(const std::vector<double>& ratios, double finalDriveRatio);
+    explicit Gearbox(const GearboxParams& params);
 
     double engineToWheelRatio();
     double wheelToEngineRatio() const;
 
-    double convertEngineTorqueToWheel(double engineTorque, Engine* engine, double wheelOmega);
+    // Clutch torque solved implicitly against the engine and the driven
+    // wheels, returned at the wheels. wheelInertia and wheelLoadTorque are the
+    // driven wheels' combined inertia and non-drive torque this step. Stable
+    // for any dt; the caller must apply the same torque to the engine.
+    double convertEngineTorqueToWheel(double engineTorque, Engine* engine, double wheelOmega,
+                                      double wheelInertia, double wheelLoadTorque, double dt);
     double convertWheelTorqueToEngine(double wheelTorque);
 
     bool isClutchHeld() const;
@@ -37,8 +64,10 @@ public:
     int getCurrentGear() const;
     double getGearRatio() const;
 
-    double calculateBite();
-    void update();
+    double calculateBite() const;
+    // In gear with the clutch engaged past the lock threshold.
+    bool isClutchLocked() const;
+    void update(double dt);
 
     double getEngineTorque();
     double getClutchEngagement() const;
@@ -46,6 +75,9 @@ public:
     double getClutchSlip() const;
     double getReflectedEngineInertia(double engineInertia) const;
     double getReflectedWheelInertia(double wheelInertia) const;
+
+    State getState() const;
+    void setState(const State& state);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef STEERINGGEOMETRY_H
+#define STEERINGGEOMETRY_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "vehicle/VehicleParams.h"
+
+// Ackermann front-wheel angles for a steering wheel angle, shared by Car and
+// Fleet. The inner and outer angles are tabulated with their slopes over
+// [0, maxSteeringAngle] when the geometry is built, and a lookup is a cubic
+// Hermite interpolation: within 1e-10 rad of the closed form in double, in
+// place of a tan and two atans per car per step. Steering angles beyond the
+// maximum read the last entry.
+//
+// As in Car, base angles under 0.001 rad leave the wheels straight, and past
+// the point where the inner turn radius reaches zero the inner wheel's angle
+// flips sign. The table holds the inner angle unwrapped so it stays smooth
+// there, and lookups wrap it back.
+template <typename Scalar>
+class SteeringGeometry {
+public:
+    static constexpr int INTERVALS = 256;
+    static constexpr double DEADBAND = 0.001;
+
+    struct WheelAngles {
+        Scalar left{0};
+        Scalar right{0};
+    };
+
+    explicit SteeringGeometry(const VehicleParams& params = VehicleParams());
+
+    // Positive steering turns left, as Car::steering_angle.
+    WheelAngles wheelAngles(Scalar steering) const {
+        Scalar magnitude = std::abs(steering);
+        if (magnitude * steeringRack < Scalar(DEADBAND)) {
+            return {};
+        }
+
+        Scalar position = std::min(magnitude * inverseSpacing, Scalar(INTERVALS));
+        int i = std::min(static_cast<int>(position), INTERVALS - 1);
+        Scalar t = position - Scalar(i);
+        const Node& a = table[i];
+        const Node& b = table[i + 1];
+
+        // Hermite basis; the slopes are stored per interval.
+        Scalar t2 = t * t;
+        Scalar t3 = t2 * t;
+        Scalar h00 = Scalar(2) * t3 - Scalar(3) * t2 + Scalar(1);
+        Scalar h10 = t3 - Scalar(2) * t2 + t;
+        Scalar h01 = Scalar(1) - h00;
+        Scalar h11 = t3 - t2;
+        Scalar inner = h00 * a.inner + h10 * a.innerSlope + h01 * b.inner + h11 * b.innerSlope;
+        Scalar outer = h00 * a.outer + h10 * a.outerSlope + h01 * b.outer + h11 * b.outerSlope;
+        if (inner > Scalar(M_PI / 2.0)) {
+            inner -= Scalar(M_PI);
+        }
+
+        if (steering > Scalar(0)) {
+            return {inner, outer};
+        }
+        return {-outer, -inner};
+    }
+
+private:
+    struct Node {
+        Scalar inner;
+        Scalar innerSlope;
+        Scalar outer;
+        Scalar outerSlope;
+    };
+
+    Scalar steeringRack;
+    Scalar inverseSpacing;
+    std::vector<Node> table;
+};
+
+extern template class SteeringGeometry<float>;
+extern template class SteeringGeometry<double>;
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef TIREMODEL_H
+#define TIREMODEL_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include "core/FastMath.h"
+#include "vehicle/VehicleParams.h"
+
+// Tire force equations shared by Wheel, Car's four-wheel kernel and the batch
+// Fleet. Templated on the scalar type so fleets can run in float; Wheel and Car
+// use the double instance. Velocities are in the car's frame, angles in
+// radians. The transcendental calls go through PhysicsMath, so a FAST_MATH
+// build evaluates them with FastMath's polynomials.
+template <typename Scalar>
+struct TireModel {
+    struct Force {
+        Scalar x;
+        Scalar y;
+        // Torque the contact patch exerts back on the wheel.
+        Scalar frictionTorque;
+        Scalar gripLevel;
+        Scalar maxFrictionForce;
+    };
+
+    // One value per tire, for evaluating several tires in SIMD lanes.
+    template <int N>
+    using Lanes = Eigen::Array<Scalar, N, 1>;
+
+    template <int N>
+    struct LaneForces {
+        Lanes<N> x;
+        Lanes<N> y;
+        Lanes<N> frictionTorque;
+        Lanes<N> gripLevel;
+        Lanes<N> maxFrictionForce;
+
+        Force at(int i) const {
+            return {x[i], y[i], frictionTorque[i], gripLevel[i], maxFrictionForce[i]};
+        }
+    };
+
+    Scalar radius;
+    Scalar momentOfInertia;
+    Scalar friction;
+    Scalar peakSlipAngle;
+    Scalar slideRatio;
+    Scalar lowSpeedThreshold;
+
+    static TireModel fromParams(const TireParams& tire) {
+        return {Scalar(tire.radius), Scalar(tire.momentOfInertia), Scalar(tire.friction),
+                Scalar(tire.peakSlipAngle), Scalar(tire.slideRatio), Scalar(tire.lowSpeedThreshold)};
+    }
+
+    Scalar maxFrictionForce(Scalar normalForce) const {
+        const Scalar nominalLoad = Scalar(2943.0);
+        const Scalar loadSensitivity = Scalar(0.9);
+        Scalar loadFactor = PhysicsMath::pow(normalForce / nominalLoad, loadSensitivity);
+        return nominalLoad * friction * loadFactor;
+    }
+
+    Scalar longitudinalFriction(Scalar longitudinalSlip, Scalar normalForce, Scalar maxForce, Scalar dt) const {
+        if (std::abs(longitudinalSlip) <= Scalar(1e-5)) {
+            return Scalar(0);
+        }
+
+        const Scalar LONGITUDINAL_FRICTION_RESPONSE = Scalar(0.6);
+        Scalar wheelMass = normalForce / Scalar(9.81);
+        Scalar requiredForce = (longitudinalSlip / dt) * wheelMass * LONGITUDINAL_FRICTION_RESPONSE;
+        return std::clamp(requiredForce, -maxForce, maxForce);
+    }
+
+    Scalar frictionTorque(Scalar longitudinalForce, Scalar normalForce) const {
+        Scalar wheelMass = normalForce / Scalar(9.81);
+        Scalar wheelEffectiveMass = momentOfInertia / (radius * radius);
+        return longitudinalForce * radius * (wheelEffectiveMass / wheelMass);
+    }
+
+    Force evaluate(Scalar wheelAngle, Scalar vx, Scalar vy, Scalar omega, Scalar normalForce, Scalar dt) const {
+        Scalar sinAngle = PhysicsMath::sin(wheelAngle);
+        Scalar cosAngle = PhysicsMath::cos(wheelAngle);
+
+        Scalar velocityInWheelDir = vx * sinAngle + vy * cosAngle;
+        Scalar wheelLinearVelocity = radius * omega;
+        Scalar longitudinalSlip = wheelLinearVelocity - velocityInWheelDir;
+
+        Scalar wheelMass = normalForce / Scalar(9.81);
+        Scalar maxForce = maxFrictionForce(normalForce);
+
+        Scalar longitudinalForce = longitudinalFriction(longitudinalSlip, normalForce, maxForce, dt);
+        Scalar torque = longitudinalForce != Scalar(0) ? frictionTorque(longitudinalForce, normalForce) : Scalar(0);
+
+        Scalar lateralVelocity = vx * cosAngle + vy * -sinAngle;
+        Scalar lateralFriction = Scalar(0);
+
+        if (std::abs(lateralVelocity) > Scalar(1e-5)) {
+            Scalar speed = std::sqrt(velocityInWheelDir * velocityInWheelDir +
+                                     lateralVelocity * lateralVelocity);
+
+            if (speed < lowSpeedThreshold) {
+                const Scalar LATERAL_FRICTION_RESPONSE = Scalar(0.45);
+                Scalar requiredLateralForce = -(lateralVelocity / dt) * wheelMass * LATERAL_FRICTION_RESPONSE;
+                lateralFriction = std::clamp(requiredLateralForce, -maxForce, maxForce);
+            } else {
+                Scalar slipAngle = PhysicsMath::atan2(std::abs(lateralVelocity), std::abs(velocityInWheelDir));
+
+                Scalar normalizedAngle = slipAngle / peakSlipAngle;
+                Scalar forceMagnitude = Scalar(0);
+
+                if (normalizedAngle <= Scalar(1)) {
+                    forceMagnitude = maxForce * PhysicsMath::sin(normalizedAngle * Scalar(M_PI) / Scalar(2));
+                } else {
+                    Scalar excessAngle = slipAngle - peakSlipAngle;
+                    const Scalar decayRate = Scalar(8.0);
+                    forceMagnitude = maxForce * (slideRatio + (Scalar(1) - slideRatio) * PhysicsMath::exp(-decayRate * excessAngle));
+                }
+
+                lateralFriction = -std::copysign(forceMagnitude, lateralVelocity);
+            }
+        }
+
+        Scalar combinedMagnitude = std::sqrt(longitudinalForce * longitudinalForce +
+                                             lateralFriction * lateralFriction);
+
+        if (combinedMagnitude > maxForce) {
+            Scalar scale = maxForce / combinedMagnitude;
+            longitudinalForce *= scale;
+            lateralFriction *= scale;
+        }
+
+        Force result;
+        result.x = sinAngle * longitudinalForce + cosAngle * lateralFriction;
+        result.y = cosAngle * longitudinalForce + -sinAngle * lateralFriction;
+        result.frictionTorque = torque;
+        result.gripLevel = (maxForce > Scalar(0)) ? (combinedMagnitude / maxForce) : Scalar(0);
+        result.maxFrictionForce = maxForce;
+        return result;
+    }
+
+    // evaluate() for N tires sharing this model, e.g. the four wheels of a
+    // car. Every branch is computed and blended with select(), so the lanes
+    // never diverge; the low-speed and post-peak cases cost both sides. Agrees
+    // with evaluate() to rounding, not bitwise.
+    template <int N>
+    LaneForces<N> evaluateLanes(const Lanes<N>& wheelAngle, const Lanes<N>& vx, const Lanes<N>& vy,
+                                const Lanes<N>& omega, const Lanes<N>& normalForce, Scalar dt) const {
+        using Array = Lanes<N>;
+        const Array zero = Array::Zero();
+
+        Array sinAngle = PhysicsMath::sin(wheelAngle);
+        Array cosAngle = PhysicsMath::cos(wheelAngle);
+
+        Array velocityInWheelDir = vx * sinAngle + vy * cosAngle;
+        Array longitudinalSlip = radius * omega - velocityInWheelDir;
+
+        Array wheelMass = normalForce / Scalar(9.81);
+        // pow(load ratio, sensitivity) as exp/log, which Eigen vectorizes.
+        const Scalar nominalLoad = Scalar(2943.0);
+        const Scalar loadSensitivity = Scalar(0.9);
+        Array maxForce = nominalLoad * friction *
+                         PhysicsMath::exp(loadSensitivity * PhysicsMath::log(normalForce / nominalLoad));
+
+        const Scalar LONGITUDINAL_FRICTION_RESPONSE = Scalar(0.6);
+        Array requiredForce = (longitudinalSlip / dt) * wheelMass * LONGITUDINAL_FRICTION_RESPONSE;
+        Array longitudinalForce = (longitudinalSlip.abs() <= Scalar(1e-5))
+                                      .select(zero, requiredForce.max(-maxForce).min(maxForce));
+        const Scalar wheelEffectiveMass = momentOfInertia / (radius * radius);
+        Array torque = (longitudinalForce != Scalar(0))
+                           .select(longitudinalForce * radius * (wheelEffectiveMass / wheelMass), zero);
+
+        Array lateralVelocity = vx * cosAngle - vy * sinAngle;
+        Array speed = (velocityInWheelDir.square() + lateralVelocity.square()).sqrt();
+
+        const Scalar LATERAL_FRICTION_RESPONSE = Scalar(0.45);
+        Array requiredLateralForce = -(lateralVelocity / dt) * wheelMass * LATERAL_FRICTION_RESPONSE;
+        Array lowSpeedFriction = requiredLateralForce.max(-maxForce).min(maxForce);
+
+        // atan2 of two magnitudes; a zero forward speed gives atan(inf) = pi/2.
+        Array slipAngle = PhysicsMath::atan(lateralVelocity.abs() / velocityInWheelDir.abs());
+        Array normalizedAngle = slipAngle / peakSlipAngle;
+        Array rising = maxForce * PhysicsMath::sin(normalizedAngle * Scalar(M_PI / 2.0));
+        const Scalar decayRate = Scalar(8.0);
+        Array sliding = maxForce * (slideRatio + (Scalar(1) - slideRatio) *
+                                                PhysicsMath::exp(-decayRate * (slipAngle - peakSlipAngle)));
+        Array forceMagnitude = (normalizedAngle <= Scalar(1)).select(rising, sliding);
+        Array slipFriction = (lateralVelocity > Scalar(0)).select(-forceMagnitude, forceMagnitude);
+
+        Array lateralFriction = (lateralVelocity.abs() > Scalar(1e-5))
+                                    .select((speed < lowSpeedThreshold).select(lowSpeedFriction, slipFriction), zero);
+
+        Array combinedMagnitude = (longitudinalForce.square() + lateralFriction.square()).sqrt();
+        Array scale = (combinedMagnitude > maxForce).select(maxForce / combinedMagnitude, Array::Ones());
+        longitudinalForce *= scale;
+        lateralFriction *= scale;
+
+        LaneForces<N> result;
+        result.x = sinAngle * longitudinalForce + cosAngle * lateralFriction;
+        result.y = cosAngle * longitudinalForce - sinAngle * lateralFriction;
+        result.frictionTorque = torque;
+        result.gripLevel = (maxForce > Scalar(0)).select(combinedMagnitude / maxForce, zero);
+        result.maxFrictionForce = maxForce;
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef VEHICLECATALOG_H
+#define VEHICLECATALOG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/MappedFile.h"
+#include "vehicle/VehicleParams.h"
+
+struct VehicleCatalogHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t count;
+};
+
+namespace VehicleCatalogFormat {
+    constexpr char MAGIC[8] = {'C', 'A', 'R', 'V', 'E', 'H', 'C', '\0'};
+    constexpr uint32_t VERSION = 1;
+}
+
+static_assert(sizeof(VehicleCatalogHeader) % alignof(VehicleParams) == 0, "records must stay aligned after the header");
+
+// A file of VehicleParams records behind a small header. Opening maps the
+// file instead of parsing it, so a catalog with thousands of vehicles costs
+// nothing until a record is actually read.
+class VehicleCatalog {
+public:
+    VehicleCatalog();
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return records != nullptr; }
+    size_t size() const { return count; }
+
+    const VehicleParams& get(size_t index) const { return records[index]; }
+    const VehicleParams* find(const std::string& name) const;
+
+    static bool write(const std::string& path, const std::vector<VehicleParams>& vehicles);
+
+private:
+    MappedFile file;
+    const VehicleParams* records;
+    size_t count;
+};
+
+#endif
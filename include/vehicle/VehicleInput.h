@@ -0,0 +1,39 @@
+#ifndef VEHICLEINPUT_H
+#define VEHICLEINPUT_H
+
+#include <cstdint>
+
+// Driver input for a single physics step. Everything the live loop feeds into
+// a Car goes through this struct, so replaying a stream of them re-simulates a
+// run exactly.
+struct VehicleInput {
+    float throttle{0.0f};
+    float brake{0.0f};
+    float steering{0.0f};
+    uint8_t clutchHeld{0};
+    int8_t shiftUps{0};
+    int8_t shiftDowns{0};
+    uint8_t reserved{0};
+};
+
+// One timestamped change to the driver's controls, as it arrives from the
+// keyboard or a joystick. Analog channels carry the new value; SHIFT_UP,
+// SHIFT_DOWN and REWIND are one-shot requests.
+struct InputEvent {
+    enum Channel : uint8_t {
+        THROTTLE,
+        BRAKE,
+        STEERING,
+        CLUTCH,
+        SHIFT_UP,
+        SHIFT_DOWN,
+        REWIND
+    };
+
+    // Steady-clock seconds, see SimulationThread::clockSeconds().
+    double time;
+    Channel channel;
+    float value;
+};
+
+#endif
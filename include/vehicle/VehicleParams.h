@@ -0,0 +1,89 @@
+#ifndef VEHICLEPARAMS_H
+#define VEHICLEPARAMS_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "config/EngineConstants.h"
+#include "config/PhysicsConstants.h"
+
+// Everything that distinguishes one vehicle from another. All lengths are in
+// meters and none of it depends on the screen, so the same parameter set
+// simulates identically everywhere. The layout is fixed-size and trivially
+// copyable so catalogs of parameter sets can be memory-mapped directly.
+
+struct TireParams {
+    double radius{PhysicsConstants::WHEEL_RADIUS};
+    double mass{PhysicsConstants::WHEEL_MASS};
+    double momentOfInertia{PhysicsConstants::WHEEL_MOMENT_OF_INERTIA};
+    double friction{PhysicsConstants::WHEEL_FRICTION};
+    double peakSlipAngle{PhysicsConstants::TIRE_PEAK_SLIP_ANGLE};
+    double slideRatio{PhysicsConstants::TIRE_SLIDE_RATIO};
+    double lowSpeedThreshold{PhysicsConstants::TIRE_LOW_SPEED_THRESHOLD};
+};
+
+struct EngineParams {
+    double cylinderVolume{EngineConstants::CYLINDER_VOLUME};
+    double efficiency{EngineConstants::ENGINE_EFFICIENCY};
+    double momentOfInertia{EngineConstants::ENGINE_MOMENT_OF_INERTIA};
+    double frictionCoefficient{EngineConstants::ENGINE_FRICTION_COEFFICIENT};
+    double maxRpm{EngineConstants::MAX_RPM};
+    double stallRpm{EngineConstants::STALL_RPM};
+};
+
+struct GearboxParams {
+    static constexpr int MAX_GEARS = 8;
+
+    int32_t gearCount{6};
+    int32_t reserved{0};
+    double gearRatios[MAX_GEARS]{3.5, 2.2, 1.5, 1.0, 0.75, 0.6};
+    double finalDrive{4.2};
+    double clutchMaxTorque{PhysicsConstants::CLUTCH_MAX_TORQUE};
+    double clutchSlipK{PhysicsConstants::CLUTCH_SLIP_K};
+    double clutchLockThreshold{PhysicsConstants::CLUTCH_LOCK_THRESHOLD};
+};
+
+struct ControllerParams {
+    double tcsSlipSetpoint{PhysicsConstants::TIRE_SLIP_SETPOINT};
+    double tcsKp{PhysicsConstants::TIRE_TCS_kP};
+    double tcsKd{PhysicsConstants::TIRE_TCS_kD};
+    double absSlipSetpoint{PhysicsConstants::ABS_SLIP_SETPOINT};
+    double absKp{PhysicsConstants::ABS_kP};
+    double absKd{PhysicsConstants::ABS_kD};
+};
+
+struct VehicleParams {
+    static constexpr int NAME_LENGTH = 32;
+
+    char name[NAME_LENGTH]{"default"};
+
+    double wheelbase{PhysicsConstants::WHEELBASE};
+    double trackWidth{PhysicsConstants::TRACK_WIDTH};
+    double bodyWidth{PhysicsConstants::CAR_BODY_WIDTH};
+    double bodyLength{PhysicsConstants::CAR_BODY_LENGTH};
+    double wheelWidthInset{0.1};
+    double wheelLengthInset{0.15};
+    double cgHeight{PhysicsConstants::CG_HEIGHT};
+    double frontWeightBias{PhysicsConstants::FRONT_WEIGHT_BIAS};
+
+    double mass{PhysicsConstants::CAR_MASS};
+    double yawMomentOfInertia{PhysicsConstants::CAR_MOMENT_OF_INERTIA};
+
+    double enginePower{PhysicsConstants::CAR_POWER};
+    double brakingPower{PhysicsConstants::BRAKING_POWER};
+    double topSpeed{PhysicsConstants::CAR_TOP_SPEED};
+
+    double steeringRack{PhysicsConstants::STEERING_RACK};
+    double maxSteeringAngle{PhysicsConstants::MAX_STEERING_ANGLE};
+    double forceFeedbackDecay{PhysicsConstants::FORCE_FEEDBACK_DECAY};
+
+    TireParams tire;
+    EngineParams engine;
+    GearboxParams gearbox;
+    ControllerParams controllers;
+};
+
+static_assert(std::is_trivially_copyable<VehicleParams>::value, "VehicleParams must be mappable");
+static_assert(sizeof(VehicleParams) % alignof(double) == 0, "catalog records must stay aligned");
+
+#endif
@@ -3,6 +3,8 @@
 
 #include "config/PhysicsConstants.h"
 #include "core/RigidBody.h"
+#include "vehicle/TireModel.h"
+#include "vehicle/VehicleParams.h"
 
 class Wheel : public RigidBody {
 public:
@@ -11,6 +13,9 @@ public:
     double wheelRadius{PhysicsConstants::WHEEL_RADIUS};
 
     double frictionCoefficient{PhysicsConstants::WHEEL_FRICTION};
+    double peakSlipAngle{PhysicsConstants::TIRE_PEAK_SLIP_ANGLE};
+    double slideRatio{PhysicsConstants::TIRE_SLIDE_RATIO};
+    double lowSpeedThreshold{PhysicsConstants::TIRE_LOW_SPEED_THRESHOLD};
 
     double normalForce{PhysicsConstants::CAR_WEIGHT / 4.0};
 
@@ -26,9 +31,26 @@ public:
     double previousAbsSlipError{0.0};
     double absInterference{0.0};
 
+    // Contact patch force and the torque it exerts back on the wheel.
+    struct TireForce {
+        Eigen::Vector2d force;
+        double frictionTorque;
+        double gripLevel;
+    };
+
     Wheel();
+    explicit Wheel(const TireParams& tire);
 
+    // Applies the friction torque to the wheel and returns the force on the
+    // body. The contact is remembered so integrators can re-evaluate the
+    // torque at other spin rates during this step.
     Eigen::Vector2d calculateFriction(Eigen::Vector2d wheelVelocityLocal, double time_interval);
+    // calculateFriction() with the tire force already evaluated, e.g. by
+    // TireModel::evaluateLanes for all four wheels at once.
+    Eigen::Vector2d applyFriction(const TireModel<double>::Force& tire, const Eigen::Vector2d& wheelVelocityLocal,
+                                  double time_interval);
+    // Friction at a given spin rate without changing the wheel.
+    TireForce evaluateFriction(const Eigen::Vector2d& wheelVelocityLocal, double omega, double time_interval) const;
 
     double calculateSlipRatio(Eigen::Vector2d wheelVelocityLocal);
 
@@ -36,6 +58,23 @@ public:
     void setLinearVelocity(double linearVelocity);
 
     void incrementTime(double time_interval);
+    template <typename Integrator>
+    void integrate(double time_interval);
+
+    TireModel<double> tireModel() const;
+
+private:
+    struct Contact {
+        bool active;
+        double forwardSpeed;
+        double maxFrictionForce;
+        double responseTime;
+    };
+    Contact contact{false, 0.0, 0.0, 0.0};
+
+    double maxFrictionForce() const;
+    double longitudinalFriction(double longitudinalSlip, double maxForce, double time_interval) const;
+    double frictionTorque(double longitudinalForce) const;
 };
 
 #endif
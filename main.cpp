@@ -1,18 +1,34 @@
 #include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
+#include "core/MultiRateScheduler.h"
 #include "vehicle/Car.h"
 #include "ui/GUI.h"
+#include "ui/InputMapper.h"
 #include "rendering/Camera.h"
 #include "rendering/Ground.h"
+#include "rendering/RenderBatch.h"
+#include "rendering/SpatialGrid.h"
+#include "telemetry/TelemetryRecorder.h"
+#include "telemetry/TelemetryReplay.h"
+#include "telemetry/RewindBuffer.h"
+#include "telemetry/GhostStreamer.h"
+#include "telemetry/SimulationThread.h"
+#include "vehicle/VehicleCatalog.h"
 #include <Eigen/Dense>
 
 #include "config/PhysicsConstants.h"
 #include "config/RenderingConstants.h"
+#include "config/UIConstants.h"
 
 struct GameState {
     SDL_Window* win;
@@ -22,89 +38,382 @@ struct GameState {
     Ground* ground;
     GUI* gui;
     bool running;
+    TelemetryRecorder* recorder;
+    TelemetryReplay* replay;
+    RewindBuffer* rewind;
+    GhostStreamer* ghosts;
+    std::vector<Car*> ghostCars;
+    double ghostTime;
+    double simTime;
+    size_t lastReplayIndex;
+    bool scrubbing;
+    RenderBatch batch;
+    SpatialGrid sceneGrid{SpatialGrid::DEFAULT_CELL_SIZE};
+    std::vector<int> visibleIds;
+    // The live car is stepped on the simulation thread; `car` only mirrors
+    // its latest snapshot for drawing.
+    SimulationThread* simulation{nullptr};
+    uint32_t seenRewindCount{0};
+    InputMapper inputMapper;
+    std::vector<InputEvent> inputEvents;
+    // Input arrival time behind the displayed snapshot, and the newest one
+    // whose latency was already recorded.
+    double displayedInputTime{0.0};
+    double measuredInputTime{0.0};
+    // Live graphs sample at GRAPH_SAMPLE_HZ of sim time, blending the last
+    // two snapshots, whatever rate the snapshots arrive at.
+    MultiRateScheduler graphClock;
+    TelemetryFrame graphFrom{};
+    TelemetryFrame graphTo{};
+    bool hasGraphFrame{false};
 };
 
 GameState* g_gameState = nullptr;
 
-void mainLoop() {
-    if (!g_gameState || !g_gameState->running) {
-#ifdef __EMSCRIPTEN__
-        emscripten_cancel_main_loop();
-#endif
+constexpr size_t NO_REPLAY_INDEX = std::numeric_limits<size_t>::max();
+
+void updateGhosts(double time) {
+    GhostStreamer* ghosts = g_gameState->ghosts;
+    if (ghosts->getGhostCount() == 0) return;
+
+    if (time < g_gameState->ghostTime || time > g_gameState->ghostTime + 1.0) {
+        ghosts->seek(time);
+    }
+    ghosts->advance(time);
+    g_gameState->ghostTime = time;
+}
+
+// Scene ids: ghost i is i, the player car comes last so it draws on top.
+Car* sceneCar(int id) {
+    GhostStreamer* ghosts = g_gameState->ghosts;
+    return static_cast<size_t>(id) < ghosts->getGhostCount() ? g_gameState->ghostCars[id] : g_gameState->car;
+}
+
+void updateSceneGrid() {
+    GhostStreamer* ghosts = g_gameState->ghosts;
+    SpatialGrid& grid = g_gameState->sceneGrid;
+
+    for (size_t i = 0; i < ghosts->getGhostCount(); i++) {
+        if (!ghosts->hasFrame(i)) {
+            grid.remove(static_cast<int>(i));
+            continue;
+        }
+        Car* ghost = g_gameState->ghostCars[i];
+        ghost->applyTelemetry(ghosts->getFrame(i));
+        grid.update(static_cast<int>(i), ghost->getRenderBounds());
+    }
+    grid.update(static_cast<int>(ghosts->getGhostCount()), g_gameState->car->getRenderBounds());
+}
+
+void drawScene() {
+    g_gameState->car->eraseCar(g_gameState->renderer);
+    g_gameState->ground->draw(g_gameState->renderer, g_gameState->camera, RenderingConstants::SDL_WINDOW_WIDTH, RenderingConstants::SDL_WINDOW_LENGTH);
+
+    updateSceneGrid();
+    WorldRect view = g_gameState->camera->visibleRect(RenderingConstants::SDL_WINDOW_WIDTH, RenderingConstants::SDL_WINDOW_LENGTH);
+    g_gameState->sceneGrid.query(view, g_gameState->visibleIds);
+
+    for (int id : g_gameState->visibleIds) {
+        sceneCar(id)->drawCar(g_gameState->batch, g_gameState->camera);
+    }
+    g_gameState->batch.flush(g_gameState->renderer);
+}
+
+void pushReplayFrame(const TelemetryFrame& frame) {
+    Car* car = g_gameState->car;
+    car->applyTelemetry(frame);
+    g_gameState->gui->updateGraphs(*car, car->actualThrottle, car->actualBrake, car->actualSteering);
+}
+
+void syncReplayFrame() {
+    TelemetryReplay* replay = g_gameState->replay;
+    size_t index = replay->getCurrentIndex();
+    size_t last = g_gameState->lastReplayIndex;
+
+    if (index == last) {
         return;
     }
 
-    SDL_Event event;
-    while (SDL_PollEvent(&event)) {
-        if (event.type == SDL_QUIT) {
-            g_gameState->running = false;
-        } else if (event.type == SDL_KEYDOWN) {
-            if (event.key.keysym.sym == SDLK_ESCAPE || event.key.keysym.sym == SDLK_q) {
-                g_gameState->running = false;
-            } else if (event.key.keysym.sym == SDLK_v) {
-                g_gameState->car->showDebugVectors = !g_gameState->car->showDebugVectors;
-            } else if (event.key.keysym.sym == SDLK_h) {
-                g_gameState->gui->toggleHUD();
-            } else if (event.key.keysym.sym == SDLK_g) {
-                g_gameState->gui->toggleGraphs();
-            } else if (event.key.keysym.sym == SDLK_e) {
-                g_gameState->car->shiftUp();
-            } else if (event.key.keysym.sym == SDLK_c) {
-                g_gameState->car->shiftDown();
-            }
+    if (last != NO_REPLAY_INDEX && index > last && index - last <= UIConstants::GRAPH_HISTORY_POINTS) {
+        for (size_t i = last + 1; i <= index; i++) {
+            pushReplayFrame(replay->getFrame(i));
+        }
+    } else {
+        size_t first = index + 1 >= UIConstants::GRAPH_HISTORY_POINTS ? index + 1 - UIConstants::GRAPH_HISTORY_POINTS : 0;
+        g_gameState->gui->clearGraphs();
+        for (size_t i = first; i <= index; i++) {
+            pushReplayFrame(replay->getFrame(i));
         }
     }
 
-    const Uint8* keystate = SDL_GetKeyboardState(NULL);
+    g_gameState->lastReplayIndex = index;
+}
 
-    double throttle = 0.0;
-    double brake = 0.0;
-    double steering = 0.0;
+void scrubReplay(int mouseX, int mouseY) {
+    TelemetryReplay* replay = g_gameState->replay;
+    double fraction;
+    if (g_gameState->gui->getReplayTimelineFraction(mouseX, mouseY, fraction)) {
+        replay->seek(replay->getStartTime() + fraction * (replay->getEndTime() - replay->getStartTime()));
+    }
+}
 
-    if (keystate[SDL_SCANCODE_W]) {
-        throttle = 1.0;
+void handleReplayEvent(const SDL_Event& event) {
+    TelemetryReplay* replay = g_gameState->replay;
+
+    if (event.type == SDL_KEYDOWN) {
+        switch (event.key.keysym.sym) {
+            case SDLK_SPACE: replay->togglePause(); break;
+            case SDLK_LEFT: replay->seekRelative(-5.0); break;
+            case SDLK_RIGHT: replay->seekRelative(5.0); break;
+            case SDLK_UP: replay->setSpeed(replay->getSpeed() * 2.0); break;
+            case SDLK_DOWN: replay->setSpeed(replay->getSpeed() / 2.0); break;
+            case SDLK_b: replay->setSpeed(-replay->getSpeed()); break;
+            case SDLK_HOME: replay->seek(replay->getStartTime()); break;
+            case SDLK_END: replay->seek(replay->getEndTime()); break;
+            case SDLK_COMMA: replay->setPaused(true); replay->stepFrames(-1); break;
+            case SDLK_PERIOD: replay->setPaused(true); replay->stepFrames(1); break;
+            default: break;
+        }
+    } else if (event.type == SDL_MOUSEBUTTONDOWN && event.button.button == SDL_BUTTON_LEFT) {
+        double fraction;
+        if (g_gameState->gui->getReplayTimelineFraction(event.button.x, event.button.y, fraction)) {
+            g_gameState->scrubbing = true;
+            scrubReplay(event.button.x, event.button.y);
+        }
+    } else if (event.type == SDL_MOUSEMOTION && g_gameState->scrubbing) {
+        scrubReplay(event.motion.x, event.motion.y);
+    } else if (event.type == SDL_MOUSEBUTTONUP && event.button.button == SDL_BUTTON_LEFT) {
+        g_gameState->scrubbing = false;
     }
-    if (keystate[SDL_SCANCODE_S]) {
-        brake = 1.0;
+}
+
+void replayLoop() {
+    TelemetryReplay* replay = g_gameState->replay;
+
+    if (!g_gameState->scrubbing) {
+        replay->update(PhysicsConstants::TIME_INTERVAL);
     }
-    if (keystate[SDL_SCANCODE_A]) {
-        steering = 1.0;
+    syncReplayFrame();
+    updateGhosts(replay->getTime());
+
+    g_gameState->camera->followTargetSmooth(g_gameState->car->pos_x, g_gameState->car->pos_y);
+
+    drawScene();
+    g_gameState->gui->drawHUD(g_gameState->renderer, *g_gameState->car, g_gameState->car->actualThrottle);
+    g_gameState->gui->drawReplayTimeline(g_gameState->renderer, replay->getTime(), replay->getStartTime(),
+                                         replay->getEndTime(), replay->getSpeed(), replay->isPaused());
+    SDL_RenderPresent(g_gameState->renderer);
+}
+
+// Graph sample at `time`, between the last two snapshots. Only what the
+// graphs show is blended; everything else comes from the newer snapshot.
+void sampleGraphs(double time) {
+    const TelemetryFrame& from = g_gameState->graphFrom;
+    const TelemetryFrame& to = g_gameState->graphTo;
+    double span = to.time - from.time;
+    double alpha = span > 0.0 ? std::clamp((time - from.time) / span, 0.0, 1.0) : 1.0;
+    auto blend = [alpha](double a, double b) { return a + (b - a) * alpha; };
+
+    TelemetryFrame frame = to;
+    frame.velocity_x = blend(from.velocity_x, to.velocity_x);
+    frame.velocity_y = blend(from.velocity_y, to.velocity_y);
+    frame.actualThrottle = blend(from.actualThrottle, to.actualThrottle);
+    frame.actualBrake = blend(from.actualBrake, to.actualBrake);
+    frame.actualSteering = blend(from.actualSteering, to.actualSteering);
+    frame.gearbox.clutchEngagement = blend(from.gearbox.clutchEngagement, to.gearbox.clutchEngagement);
+    frame.gearbox.clutchSlip = blend(from.gearbox.clutchSlip, to.gearbox.clutchSlip);
+    for (int i = 0; i < 4; i++) {
+        frame.wheels[i].gripLevel = blend(from.wheels[i].gripLevel, to.wheels[i].gripLevel);
+    }
+
+    Car* car = g_gameState->car;
+    car->applyTelemetry(frame);
+    g_gameState->gui->updateGraphs(*car, car->actualThrottle, car->actualBrake, car->actualSteering);
+}
+
+void syncLiveSnapshot() {
+    SimulationThread* simulation = g_gameState->simulation;
+    if (!simulation->pollSnapshot()) return;
+
+    const SimulationThread::Snapshot& snapshot = simulation->getSnapshot();
+    bool rewound = snapshot.rewindCount != g_gameState->seenRewindCount;
+    if (rewound) {
+        g_gameState->seenRewindCount = snapshot.rewindCount;
+        g_gameState->gui->clearGraphs();
+        g_gameState->hasGraphFrame = false;
     }
-    if (keystate[SDL_SCANCODE_D]) {
-        steering = -1.0;
+
+    if (g_gameState->hasGraphFrame) {
+        g_gameState->graphFrom = g_gameState->graphTo;
+        g_gameState->graphTo = snapshot.frame;
+        g_gameState->graphClock.advance(snapshot.frame.time - g_gameState->graphFrom.time);
+    } else {
+        g_gameState->graphTo = snapshot.frame;
+        g_gameState->graphClock.reset(snapshot.frame.time);
+        g_gameState->hasGraphFrame = true;
     }
 
-    g_gameState->car->setThrottle(throttle);
-    g_gameState->car->setBrake(brake);
-    g_gameState->car->setSteering(steering);
+    Car* car = g_gameState->car;
+    car->applyTelemetry(snapshot.frame);
+    g_gameState->simTime = snapshot.frame.time;
+    g_gameState->displayedInputTime = snapshot.inputTime;
 
-    if (keystate[SDL_SCANCODE_LSHIFT]) {
-        g_gameState->car->holdClutch();
+    if (rewound) {
+        g_gameState->camera->camera_x = car->pos_x;
+        g_gameState->camera->camera_y = car->pos_y;
+    }
+}
+
+void handleEvent(const SDL_Event& event) {
+    bool replaying = g_gameState->replay->isOpen();
+    if (replaying) {
+        handleReplayEvent(event);
     } else {
-        g_gameState->car->releaseClutch();
+        std::vector<InputEvent>& inputEvents = g_gameState->inputEvents;
+        inputEvents.clear();
+        g_gameState->inputMapper.translate(event, InputMapper::arrivalTime(event), inputEvents);
+        for (const InputEvent& input : inputEvents) {
+            g_gameState->simulation->pushInput(input);
+        }
+    }
+
+    if (event.type == SDL_QUIT) {
+        g_gameState->running = false;
+    } else if (event.type == SDL_KEYDOWN) {
+        if (event.key.keysym.sym == SDLK_ESCAPE || event.key.keysym.sym == SDLK_q) {
+            g_gameState->running = false;
+        } else if (event.key.keysym.sym == SDLK_v) {
+            g_gameState->car->showDebugVectors = !g_gameState->car->showDebugVectors;
+        } else if (event.key.keysym.sym == SDLK_h) {
+            g_gameState->gui->toggleHUD();
+        } else if (event.key.keysym.sym == SDLK_g) {
+            g_gameState->gui->toggleGraphs();
+        } else if (event.key.keysym.sym == SDLK_LEFTBRACKET) {
+            g_gameState->gui->zoomGraphs(1.0 / UIConstants::GRAPH_ZOOM_STEP);
+        } else if (event.key.keysym.sym == SDLK_RIGHTBRACKET) {
+            g_gameState->gui->zoomGraphs(UIConstants::GRAPH_ZOOM_STEP);
+        }
+    }
+}
+
+void mainLoop() {
+    if (!g_gameState || !g_gameState->running) {
+#ifdef __EMSCRIPTEN__
+        emscripten_cancel_main_loop();
+#endif
+        return;
+    }
+
+    bool replaying = g_gameState->replay->isOpen();
+
+    SDL_Event event;
+    while (SDL_PollEvent(&event)) {
+        handleEvent(event);
+    }
+
+    if (replaying) {
+        replayLoop();
+        return;
     }
 
-    g_gameState->car->updateInputs(PhysicsConstants::TIME_INTERVAL);
-    g_gameState->car->updateEngine(throttle);
-    g_gameState->car->applyBrakes();
-    g_gameState->car->sumWheelForces();
-    g_gameState->car->updateAcceleration();
+#ifdef __EMSCRIPTEN__
+    g_gameState->simulation->step();
+#endif
+    syncLiveSnapshot();
 
-    g_gameState->gui->updateGraphs(*g_gameState->car, g_gameState->car->actualThrottle, g_gameState->car->actualBrake, g_gameState->car->actualSteering);
+    updateGhosts(g_gameState->simTime);
 
     g_gameState->camera->followTargetSmooth(g_gameState->car->pos_x, g_gameState->car->pos_y);
 
-    g_gameState->car->eraseCar(g_gameState->renderer);
-    g_gameState->ground->draw(g_gameState->renderer, g_gameState->camera, RenderingConstants::SDL_WINDOW_WIDTH, RenderingConstants::SDL_WINDOW_LENGTH);
-    g_gameState->car->drawCar(g_gameState->renderer, g_gameState->camera);
+    drawScene();
     g_gameState->gui->drawHUD(g_gameState->renderer, *g_gameState->car, g_gameState->car->actualThrottle);
     SDL_RenderPresent(g_gameState->renderer);
 
-    g_gameState->car->incrementTime(PhysicsConstants::TIME_INTERVAL);
-    g_gameState->car->moveWheels();
+    if (g_gameState->displayedInputTime > g_gameState->measuredInputTime) {
+        g_gameState->measuredInputTime = g_gameState->displayedInputTime;
+        g_gameState->gui->recordInputLatency(SimulationThread::clockSeconds() - g_gameState->displayedInputTime);
+    }
 }
 
+#ifndef __EMSCRIPTEN__
+// Sleeps out the rest of the frame inside SDL's event wait, so driver input
+// reaches the simulation thread as it arrives instead of once per frame.
+void waitForNextFrame(Uint32 frameStart) {
+    Uint32 frameEnd = frameStart + PhysicsConstants::SDL_TIME_INTERVAL;
+    SDL_Event event;
+    while (g_gameState->running) {
+        Uint32 now = SDL_GetTicks();
+        if (static_cast<Sint32>(frameEnd - now) <= 0) break;
+        if (SDL_WaitEventTimeout(&event, static_cast<int>(frameEnd - now))) {
+            handleEvent(event);
+        }
+    }
+}
+#endif
+
 int main(int argc, char* argv[]) {
+    std::string recordPath;
+    std::string replayPath;
+    std::vector<std::string> ghostPaths;
+    std::string catalogPath;
+    std::string vehicleName;
+    int rewindInterval = RewindBuffer::DEFAULT_KEYFRAME_INTERVAL;
+    size_t rewindBudget = RewindBuffer::DEFAULT_MEMORY_BUDGET;
+    bool multiRate = false;
+    int wheelSubsteps = 1;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (arg == "--ghost" && i + 1 < argc) {
+            ghostPaths.push_back(argv[++i]);
+        } else if (arg == "--vehicle-catalog" && i + 1 < argc) {
+            catalogPath = argv[++i];
+        } else if (arg == "--vehicle" && i + 1 < argc) {
+            vehicleName = argv[++i];
+        } else if (arg == "--rewind-interval" && i + 1 < argc) {
+            rewindInterval = std::atoi(argv[++i]);
+        } else if (arg == "--rewind-budget-mb" && i + 1 < argc) {
+            rewindBudget = static_cast<size_t>(std::atof(argv[++i]) * 1024 * 1024);
+        } else if (arg == "--multi-rate") {
+            multiRate = true;
+        } else if (arg == "--wheel-substeps" && i + 1 < argc) {
+            wheelSubsteps = std::atoi(argv[++i]);
+        }
+    }
+
+    VehicleParams vehicleParams;
+    if (!catalogPath.empty()) {
+        VehicleCatalog catalog;
+        if (!catalog.open(catalogPath)) {
+            std::cerr << "Failed to open vehicle catalog: " << catalogPath << std::endl;
+            return 1;
+        }
+        const VehicleParams* found = nullptr;
+        if (catalog.size() > 0) {
+            found = vehicleName.empty() ? &catalog.get(0) : catalog.find(vehicleName);
+        }
+        if (found == nullptr) {
+            std::cerr << "Vehicle not found in catalog: " << vehicleName << std::endl;
+            return 1;
+        }
+        vehicleParams = *found;
+    }
+
+    TelemetryReplay* replay = new TelemetryReplay();
+    if (!replayPath.empty() && !replay->open(replayPath)) {
+        std::cerr << "Failed to open telemetry recording: " << replayPath << std::endl;
+        delete replay;
+        return 1;
+    }
+
+    TelemetryRecorder* recorder = new TelemetryRecorder();
+    if (!recordPath.empty() && !recorder->open(recordPath, PhysicsConstants::TIME_INTERVAL)) {
+        std::cerr << "Failed to open telemetry output: " << recordPath << std::endl;
+    }
+
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
         return 1;
@@ -166,7 +475,12 @@ int main(int argc, char* argv[]) {
     joystick = SDL_JoystickOpen(0);
 #endif
 
-    Car* car = new Car(RenderingConstants::CENTER_X, RenderingConstants::CENTER_Y, RenderingConstants::CAR_WIDTH, RenderingConstants::CAR_LENGTH);
+    Car* car = new Car(RenderingConstants::CENTER_X, RenderingConstants::CENTER_Y, RenderingConstants::CAR_WIDTH, RenderingConstants::CAR_LENGTH, vehicleParams);
+    Car* simCar = new Car(RenderingConstants::CENTER_X, RenderingConstants::CENTER_Y, RenderingConstants::CAR_WIDTH, RenderingConstants::CAR_LENGTH, vehicleParams);
+    if (multiRate) {
+        simCar->setSubsystemRates(PhysicsConstants::WHEEL_RATE, PhysicsConstants::CHASSIS_RATE);
+    }
+    simCar->setWheelSubsteps(wheelSubsteps);
     Camera* camera = new Camera(car->pos_x, car->pos_y, 0.1);
     Ground* ground = new Ground(100);
 
@@ -176,23 +490,67 @@ int main(int argc, char* argv[]) {
         std::cerr << "Warning: Failed to initialize GUI" << std::endl;
     }
 
-    g_gameState = new GameState{win, renderer, car, camera, ground, gui, true};
+    RewindBuffer* rewind = new RewindBuffer(rewindInterval, rewindBudget);
+
+    GhostStreamer* ghosts = new GhostStreamer();
+    std::vector<Car*> ghostCars;
+    for (const std::string& path : ghostPaths) {
+        if (!ghosts->addGhost(path)) {
+            std::cerr << "Failed to open ghost recording: " << path << std::endl;
+            continue;
+        }
+        Car* ghost = new Car(car->pos_x, car->pos_y, RenderingConstants::CAR_WIDTH, RenderingConstants::CAR_LENGTH);
+        ghost->showDebugVectors = false;
+        ghost->renderAlpha = UIConstants::GHOST_ALPHA;
+        ghostCars.push_back(ghost);
+    }
+    ghosts->start();
+
+    g_gameState = new GameState{win, renderer, car, camera, ground, gui, true,
+                                recorder, replay, rewind, ghosts, ghostCars, 0.0,
+                                0.0, NO_REPLAY_INDEX, false};
+
+    SimulationThread* simulation = new SimulationThread(*simCar, *rewind, *recorder);
+    g_gameState->simulation = simulation;
+    g_gameState->graphClock.addTask(UIConstants::GRAPH_SAMPLE_HZ, [](double) {
+        sampleGraphs(g_gameState->graphClock.getTime());
+    });
+#ifndef __EMSCRIPTEN__
+    if (!replay->isOpen()) {
+        simulation->start();
+    }
+#endif
 
 #ifdef __EMSCRIPTEN__
     emscripten_set_main_loop(mainLoop, 60, 1);
 #else
     while (g_gameState->running) {
+        Uint32 frameStart = SDL_GetTicks();
         mainLoop();
-        SDL_Delay(PhysicsConstants::SDL_TIME_INTERVAL);
+        waitForNextFrame(frameStart);
     }
 #endif
 
+    delete simulation;
+    delete ghosts;
+    for (Car* ghost : ghostCars) {
+        delete ghost;
+    }
+    delete rewind;
+    delete recorder;
+    delete replay;
     delete gui;
     delete ground;
     delete camera;
     delete car;
+    delete simCar;
     delete g_gameState;
 
+#ifndef __EMSCRIPTEN__
+    if (joystick != nullptr) {
+        SDL_JoystickClose(joystick);
+    }
+#endif
     SDL_DestroyWindow(win);
     SDL_Quit();
     return 0;
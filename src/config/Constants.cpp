@@ -1,7 +1,6 @@
 #include <cmath>
 #include <algorithm>
 #include "config/RenderingConstants.h"
-#include "config/PhysicsConstants.h"
 
 namespace RenderingConstants {
     int SDL_WINDOW_WIDTH = 1920;
@@ -12,13 +11,6 @@ namespace RenderingConstants {
     int CAR_WIDTH = static_cast<int>(std::floor(25.0 * SCALING_FACTOR));
     int CAR_LENGTH = static_cast<int>(std::floor(45.0 * SCALING_FACTOR));
 
-    double WHEELBASE = (CAR_LENGTH / PhysicsConstants::PIXELS_PER_METER);
-    double TRACK_WIDTH = (CAR_WIDTH / PhysicsConstants::PIXELS_PER_METER);
-    double CAR_MOMENT_OF_INERTIA = (PhysicsConstants::CAR_MASS / 12.0) * (
-        (CAR_WIDTH / 10.0) * (CAR_WIDTH / 10.0) +
-        (CAR_LENGTH / 10.0) * (CAR_LENGTH / 10.0)
-    );
-
     void initializeScreenDependentConstants(int screenWidth, int screenHeight) {
         SDL_WINDOW_WIDTH = screenWidth;
         SDL_WINDOW_LENGTH = screenHeight;
@@ -27,12 +19,5 @@ namespace RenderingConstants {
 
         CAR_WIDTH = std::floor(std::min(screenWidth, screenHeight) * 0.025);
         CAR_LENGTH = std::floor(CAR_WIDTH * 1.8);
-
-        WHEELBASE = (CAR_LENGTH / PhysicsConstants::PIXELS_PER_METER);
-        TRACK_WIDTH = (CAR_WIDTH / PhysicsConstants::PIXELS_PER_METER);
-        CAR_MOMENT_OF_INERTIA = (PhysicsConstants::CAR_MASS / 12.0) * (
-            (CAR_WIDTH / 10.0) * (CAR_WIDTH / 10.0) +
-            (CAR_LENGTH / 10.0) * (CAR_LENGTH / 10.0)
-        );
     }
 }
@@ -0,0 +1,52 @@
+#include "core/MultiRateScheduler.h"
+
+#include <algorithm>
+
+namespace {
+    // Slack for clock and phase comparisons, so a rate that divides the base
+    // rate lands on its tick despite rounding.
+    const double EPSILON = 1e-9;
+}
+
+int MultiRateScheduler::addTask(double rate, Task task) {
+    tasks.push_back({rate, std::move(task), 0.0, ticks, 0});
+    if (rate > baseRate) {
+        baseRate = rate;
+        basePeriod = 1.0 / rate;
+    }
+    return static_cast<int>(tasks.size()) - 1;
+}
+
+void MultiRateScheduler::advance(double seconds) {
+    if (tasks.empty()) return;
+
+    pending += seconds;
+    while (pending >= basePeriod * (1.0 - EPSILON)) {
+        pending -= basePeriod;
+        tick();
+    }
+}
+
+void MultiRateScheduler::reset(double time) {
+    origin = time;
+    ticks = 0;
+    pending = 0.0;
+    for (Entry& entry : tasks) {
+        entry.phase = 0.0;
+        entry.lastTick = 0;
+    }
+}
+
+void MultiRateScheduler::tick() {
+    ticks++;
+    for (Entry& entry : tasks) {
+        entry.phase += entry.rate;
+        if (entry.phase < baseRate * (1.0 - EPSILON)) continue;
+
+        entry.phase = std::max(0.0, entry.phase - baseRate);
+        double dt = (ticks - entry.lastTick) * basePeriod;
+        entry.lastTick = ticks;
+        entry.runs++;
+        entry.task(dt);
+    }
+}
@@ -4,7 +4,6 @@
 #include <iostream>
 
 #include "config/PhysicsConstants.h"
-#include "config/RenderingConstants.h"
 #include "rendering/Camera.h"
 
 RigidBody::RigidBody()
@@ -12,7 +11,7 @@ RigidBody::RigidBody()
     angular_position(0), angular_velocity(0), angular_acceleration(0), angular_torque(0) {
 
     mass = PhysicsConstants::CAR_MASS;
-    moment_of_inertia = RenderingConstants::CAR_MOMENT_OF_INERTIA;
+    moment_of_inertia = PhysicsConstants::CAR_MOMENT_OF_INERTIA;
 }
 
 int RigidBody::getPositionX(const Camera* camera, int screenWidth) {
@@ -60,27 +59,25 @@ void RigidBody::updateAcceleration() {
 }
 
 void RigidBody::incrementTime(double time_interval) {
-    acceleration = forces / mass;
-
-    double dx_meters = velocity.x() * time_interval + 0.5 * acceleration.x() * time_interval * time_interval;
-    double dy_meters = velocity.y() * time_interval + 0.5 * acceleration.y() * time_interval * time_interval;
-
-    pos_x += dx_meters * PhysicsConstants::PIXELS_PER_METER;
-    pos_y -= dy_meters * PhysicsConstants::PIXELS_PER_METER;
+    integrate<ChassisIntegrator>(time_interval, [this](const Eigen::Vector3d&, const Eigen::Vector3d&) {
+        return Eigen::Vector3d(acceleration.x(), acceleration.y(), angular_acceleration);
+    });
+}
 
-    velocity = velocity + acceleration * time_interval;
+void RigidBody::finishStep(const Eigen::Vector3d& displacement, const Eigen::Vector3d& newVelocity) {
+    pos_x += displacement.x() * PhysicsConstants::PIXELS_PER_METER;
+    pos_y -= displacement.y() * PhysicsConstants::PIXELS_PER_METER;
+    angular_position += displacement.z();
 
-    angular_acceleration = angular_torque / moment_of_inertia;
-    angular_position += angular_velocity * time_interval + 0.5 * angular_acceleration * time_interval * time_interval;
-    angular_velocity += angular_acceleration * time_interval;
+    velocity = newVelocity.head<2>();
+    angular_velocity = newVelocity.z();
 
     if (std::isfinite(angular_position)) {
         angular_position = std::remainder(angular_position, 2.0 * M_PI);
     }
 
-#ifndef __EMSCRIPTEN__
-    static int frame_count = 0;
-    if (frame_count++ % 30 == 0) {
+#ifdef PHYSICS_DEBUG_LOGGING
+    if (debugFrameCount++ % 30 == 0) {
         std::cout << "Angle: " << angular_position * PhysicsConstants::RAD_TO_DEG
                   << "° | AngVel: " << angular_velocity
                   << " | Torque: " << angular_torque << std::endl;
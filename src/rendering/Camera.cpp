@@ -18,4 +18,9 @@ int Camera::worldToScreenX(double world_x, int screen_width) const {
 
 int Camera::worldToScreenY(double world_y, int screen_height) const {
     return static_cast<int>(world_y - camera_y + screen_height / 2);
-}
\ No newline at end of file
+}
+WorldRect Camera::visibleRect(int screen_width, int screen_height) const {
+    double left = camera_x - screen_width / 2;
+    double top = camera_y - screen_height / 2;
+    return {left, top, left + screen_width, top + screen_height};
+}
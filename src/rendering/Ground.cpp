@@ -1,29 +1,135 @@
 #include "rendering/Ground.h"
 #include "rendering/Camera.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
-Ground::Ground(int spacing)
-    : grid_spacing(spacing), line_r(60), line_g(60), line_b(60) {}
+Ground::Ground(int spacing, int tileSize, size_t maxCachedTiles)
+    : grid_spacing(spacing), line_r(60), line_g(60), line_b(60),
+      tileSize(std::max(1, tileSize)), maxCachedTiles(std::max<size_t>(1, maxCachedTiles)),
+      cachedRenderer(nullptr) {}
+
+Ground::~Ground() {
+    invalidate();
+}
+
+void Ground::addDecorator(TileDecorator decorator) {
+    decorators.push_back(std::move(decorator));
+    invalidate();
+}
+
+void Ground::invalidate() {
+    for (auto& entry : tiles) {
+        SDL_DestroyTexture(entry.second.texture);
+    }
+    tiles.clear();
+    lru.clear();
+}
+
+uint64_t Ground::tileKey(int64_t tileX, int64_t tileY) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+}
+
+void Ground::evictOldest() {
+    auto found = tiles.find(lru.back());
+    SDL_DestroyTexture(found->second.texture);
+    tiles.erase(found);
+    lru.pop_back();
+}
+
+SDL_Texture* Ground::rasterizeTile(SDL_Renderer* renderer, int64_t tileX, int64_t tileY) {
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                             SDL_TEXTUREACCESS_TARGET, tileSize, tileSize);
+    if (texture == nullptr) {
+        SDL_Log("Failed to create ground tile: %s", SDL_GetError());
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, texture);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    int64_t originX = tileX * tileSize;
+    int64_t originY = tileY * tileSize;
+
+    // Grid lines sit on world multiples of grid_spacing, so they line up
+    // across tile edges.
+    SDL_SetRenderDrawColor(renderer, line_r, line_g, line_b, 120);
+    int64_t firstX = static_cast<int64_t>(std::ceil(static_cast<double>(originX) / grid_spacing)) * grid_spacing;
+    for (int64_t x = firstX; x < originX + tileSize; x += grid_spacing) {
+        int localX = static_cast<int>(x - originX);
+        SDL_RenderDrawLine(renderer, localX, 0, localX, tileSize - 1);
+    }
+    int64_t firstY = static_cast<int64_t>(std::ceil(static_cast<double>(originY) / grid_spacing)) * grid_spacing;
+    for (int64_t y = firstY; y < originY + tileSize; y += grid_spacing) {
+        int localY = static_cast<int>(y - originY);
+        SDL_RenderDrawLine(renderer, 0, localY, tileSize - 1, localY);
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_Rect bounds = {static_cast<int>(originX), static_cast<int>(originY), tileSize, tileSize};
+    for (const TileDecorator& decorator : decorators) {
+        decorator(renderer, bounds);
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    return texture;
+}
+
+SDL_Texture* Ground::getTile(SDL_Renderer* renderer, int64_t tileX, int64_t tileY) {
+    uint64_t key = tileKey(tileX, tileY);
+    auto found = tiles.find(key);
+    if (found != tiles.end()) {
+        lru.splice(lru.begin(), lru, found->second.lruPosition);
+        return found->second.texture;
+    }
+
+    SDL_Texture* texture = rasterizeTile(renderer, tileX, tileY);
+    if (texture == nullptr) return nullptr;
+
+    if (tiles.size() >= maxCachedTiles) {
+        evictOldest();
+    }
+    lru.push_front(key);
+    tiles[key] = Tile{texture, lru.begin()};
+    return texture;
+}
 
 void Ground::draw(SDL_Renderer* renderer, const Camera* camera,
                   int screenWidth, int screenHeight) {
+    if (renderer != cachedRenderer) {
+        invalidate();
+        cachedRenderer = renderer;
+    }
+
     double left = camera->camera_x - screenWidth / 2;
-    double right = camera->camera_x + screenWidth / 2;
     double top = camera->camera_y - screenHeight / 2;
-    double bottom = camera->camera_y + screenHeight / 2;
 
-    int start_x = static_cast<int>(left / grid_spacing) * grid_spacing;
-    int start_y = static_cast<int>(top / grid_spacing) * grid_spacing;
+    int64_t firstTileX = static_cast<int64_t>(std::floor(left / tileSize));
+    int64_t lastTileX = static_cast<int64_t>(std::floor((left + screenWidth) / tileSize));
+    int64_t firstTileY = static_cast<int64_t>(std::floor(top / tileSize));
+    int64_t lastTileY = static_cast<int64_t>(std::floor((top + screenHeight) / tileSize));
 
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, line_r, line_g, line_b, 120);
+    // Place tiles from one floored origin so neighbours never leave a seam.
+    int originX = static_cast<int>(std::floor(firstTileX * static_cast<double>(tileSize) - left));
+    int originY = static_cast<int>(std::floor(firstTileY * static_cast<double>(tileSize) - top));
 
-    for (int x = start_x; x < right; x += grid_spacing) {
-        int screen_x = camera->worldToScreenX(x, screenWidth);
-        SDL_RenderDrawLine(renderer, screen_x, 0, screen_x, screenHeight);
-    }
+    for (int64_t tileY = firstTileY; tileY <= lastTileY; tileY++) {
+        for (int64_t tileX = firstTileX; tileX <= lastTileX; tileX++) {
+            SDL_Texture* texture = getTile(renderer, tileX, tileY);
+            if (texture == nullptr) continue;
 
-    for (int y = start_y; y < bottom; y += grid_spacing) {
-        int screen_y = camera->worldToScreenY(y, screenHeight);
-        SDL_RenderDrawLine(renderer, 0, screen_y, screenWidth, screen_y);
+            SDL_Rect dest = {
+                originX + static_cast<int>(tileX - firstTileX) * tileSize,
+                originY + static_cast<int>(tileY - firstTileY) * tileSize,
+                tileSize,
+                tileSize
+            };
+            SDL_RenderCopy(renderer, texture, nullptr, &dest);
+        }
     }
 }
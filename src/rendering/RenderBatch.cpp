@@ -0,0 +1,79 @@
+#include "rendering/RenderBatch.h"
+#include <cmath>
+
+int RenderBatch::addVertex(LayerGeometry& geometry, SDL_FPoint position, SDL_Color color) {
+    SDL_Vertex vertex;
+    vertex.position = position;
+    vertex.color = color;
+    vertex.tex_coord = {0.0f, 0.0f};
+    geometry.vertices.push_back(vertex);
+    return static_cast<int>(geometry.vertices.size()) - 1;
+}
+
+void RenderBatch::addTriangle(Layer layer, SDL_FPoint a, SDL_FPoint b, SDL_FPoint c, SDL_Color color) {
+    LayerGeometry& geometry = layers[layer];
+    geometry.indices.push_back(addVertex(geometry, a, color));
+    geometry.indices.push_back(addVertex(geometry, b, color));
+    geometry.indices.push_back(addVertex(geometry, c, color));
+}
+
+void RenderBatch::addQuad(Layer layer, const SDL_FPoint corners[4], SDL_Color color) {
+    LayerGeometry& geometry = layers[layer];
+    int first = addVertex(geometry, corners[0], color);
+    for (int i = 1; i < 4; i++) {
+        addVertex(geometry, corners[i], color);
+    }
+
+    const int quadIndices[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : quadIndices) {
+        geometry.indices.push_back(first + index);
+    }
+}
+
+void RenderBatch::addRect(Layer layer, float x, float y, float w, float h, SDL_Color color) {
+    const SDL_FPoint corners[4] = {{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}};
+    addQuad(layer, corners, color);
+}
+
+void RenderBatch::addLine(Layer layer, float x1, float y1, float x2, float y2, SDL_Color color, float thickness) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length < 1e-6f) {
+        addRect(layer, x1 - thickness * 0.5f, y1 - thickness * 0.5f, thickness, thickness, color);
+        return;
+    }
+
+    // Offset both ends by half the thickness along the segment normal.
+    float nx = -dy / length * thickness * 0.5f;
+    float ny = dx / length * thickness * 0.5f;
+    const SDL_FPoint corners[4] = {
+        {x1 + nx, y1 + ny}, {x2 + nx, y2 + ny}, {x2 - nx, y2 - ny}, {x1 - nx, y1 - ny}
+    };
+    addQuad(layer, corners, color);
+}
+
+int RenderBatch::flush(SDL_Renderer* renderer) {
+    int drawCalls = 0;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    for (LayerGeometry& geometry : layers) {
+        if (geometry.indices.empty()) continue;
+
+        SDL_RenderGeometry(renderer, nullptr,
+                           geometry.vertices.data(), static_cast<int>(geometry.vertices.size()),
+                           geometry.indices.data(), static_cast<int>(geometry.indices.size()));
+        drawCalls++;
+    }
+
+    clear();
+    return drawCalls;
+}
+
+void RenderBatch::clear() {
+    // Keeps capacity so steady-state frames don't allocate.
+    for (LayerGeometry& geometry : layers) {
+        geometry.vertices.clear();
+        geometry.indices.clear();
+    }
+}
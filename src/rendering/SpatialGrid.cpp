@@ -0,0 +1,116 @@
+#include "rendering/SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(double cellSize)
+    : cellSize(cellSize > 0.0 ? cellSize : DEFAULT_CELL_SIZE), objectCount(0), currentStamp(0) {}
+
+uint64_t SpatialGrid::cellKey(int64_t cellX, int64_t cellY) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+}
+
+SpatialGrid::CellRange SpatialGrid::cellRangeFor(const WorldRect& bounds) const {
+    return {
+        static_cast<int64_t>(std::floor(bounds.minX / cellSize)),
+        static_cast<int64_t>(std::floor(bounds.minY / cellSize)),
+        static_cast<int64_t>(std::floor(bounds.maxX / cellSize)),
+        static_cast<int64_t>(std::floor(bounds.maxY / cellSize))
+    };
+}
+
+void SpatialGrid::addToCells(int id, const CellRange& range) {
+    for (int64_t y = range.minY; y <= range.maxY; y++) {
+        for (int64_t x = range.minX; x <= range.maxX; x++) {
+            cells[cellKey(x, y)].push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::removeFromCells(int id, const CellRange& range) {
+    for (int64_t y = range.minY; y <= range.maxY; y++) {
+        for (int64_t x = range.minX; x <= range.maxX; x++) {
+            auto found = cells.find(cellKey(x, y));
+            if (found == cells.end()) continue;
+
+            std::vector<int>& ids = found->second;
+            auto position = std::find(ids.begin(), ids.end(), id);
+            if (position != ids.end()) {
+                *position = ids.back();
+                ids.pop_back();
+            }
+            if (ids.empty()) {
+                cells.erase(found);
+            }
+        }
+    }
+}
+
+void SpatialGrid::update(int id, const WorldRect& bounds) {
+    if (id < 0) return;
+    if (static_cast<size_t>(id) >= entries.size()) {
+        entries.resize(id + 1);
+        queryStamps.resize(id + 1, 0);
+    }
+
+    Entry& entry = entries[id];
+    CellRange range = cellRangeFor(bounds);
+    entry.bounds = bounds;
+
+    if (entry.active) {
+        if (range == entry.cells) return;
+        removeFromCells(id, entry.cells);
+    } else {
+        entry.active = true;
+        objectCount++;
+    }
+
+    entry.cells = range;
+    addToCells(id, range);
+}
+
+void SpatialGrid::remove(int id) {
+    if (!contains(id)) return;
+
+    Entry& entry = entries[id];
+    removeFromCells(id, entry.cells);
+    entry.active = false;
+    objectCount--;
+}
+
+void SpatialGrid::clear() {
+    entries.clear();
+    cells.clear();
+    queryStamps.clear();
+    objectCount = 0;
+}
+
+bool SpatialGrid::contains(int id) const {
+    return id >= 0 && static_cast<size_t>(id) < entries.size() && entries[id].active;
+}
+
+void SpatialGrid::query(const WorldRect& area, std::vector<int>& result) const {
+    result.clear();
+
+    if (++currentStamp == 0) {
+        std::fill(queryStamps.begin(), queryStamps.end(), 0);
+        currentStamp = 1;
+    }
+
+    CellRange range = cellRangeFor(area);
+    for (int64_t y = range.minY; y <= range.maxY; y++) {
+        for (int64_t x = range.minX; x <= range.maxX; x++) {
+            auto found = cells.find(cellKey(x, y));
+            if (found == cells.end()) continue;
+
+            for (int id : found->second) {
+                if (queryStamps[id] == currentStamp) continue;
+                queryStamps[id] = currentStamp;
+                if (entries[id].bounds.intersects(area)) {
+                    result.push_back(id);
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+}
@@ -0,0 +1,169 @@
+#include "telemetry/GhostStreamer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+
+namespace {
+    constexpr size_t FRAMES_PER_PASS = 64;
+}
+
+GhostStreamer::GhostStreamer(size_t readAhead) : readAhead(readAhead), running(false) {}
+
+GhostStreamer::~GhostStreamer() {
+    stop();
+    for (auto& track : tracks) {
+        if (track->file != nullptr) {
+            std::fclose(track->file);
+        }
+    }
+}
+
+bool GhostStreamer::addGhost(const std::string& path) {
+    if (running) return false;
+
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    TelemetryHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, Telemetry::MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != Telemetry::VERSION ||
+        header.frameSize != sizeof(TelemetryFrame)) {
+        std::fclose(file);
+        return false;
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    long dataSize = std::ftell(file) - static_cast<long>(sizeof(TelemetryHeader));
+    std::fseek(file, sizeof(TelemetryHeader), SEEK_SET);
+
+    auto track = std::make_unique<Track>(readAhead);
+    track->file = file;
+    track->frameCount = std::max(0L, dataSize) / static_cast<long>(sizeof(TelemetryFrame));
+    tracks.push_back(std::move(track));
+    return true;
+}
+
+void GhostStreamer::start() {
+    if (running || tracks.empty()) return;
+
+    running = true;
+    worker = std::thread(&GhostStreamer::run, this);
+}
+
+void GhostStreamer::stop() {
+    if (!running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running = false;
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+void GhostStreamer::advance(double time) {
+    bool consumed = false;
+
+    for (auto& track : tracks) {
+        while (const GhostSample* sample = track->queue.front()) {
+            if (sample->generation != track->consumerGeneration) {
+                track->queue.popFront();
+                consumed = true;
+                continue;
+            }
+            if (sample->frame.time > time) {
+                break;
+            }
+            track->current = sample->frame;
+            track->hasCurrent = true;
+            track->queue.popFront();
+            consumed = true;
+        }
+    }
+
+    if (consumed) {
+        wake.notify_one();
+    }
+}
+
+void GhostStreamer::seek(double time) {
+    for (auto& track : tracks) {
+        track->seekTime.store(time, std::memory_order_relaxed);
+        track->consumerGeneration++;
+        track->requestedGeneration.store(track->consumerGeneration, std::memory_order_release);
+        track->hasCurrent = false;
+    }
+    wake.notify_one();
+}
+
+bool GhostStreamer::fillTrack(Track& track) {
+    uint32_t requested = track.requestedGeneration.load(std::memory_order_acquire);
+    if (requested != track.producerGeneration) {
+        long frame = findFrame(track, track.seekTime.load(std::memory_order_relaxed));
+        long offset = static_cast<long>(sizeof(TelemetryHeader) + frame * sizeof(TelemetryFrame));
+        std::fseek(track.file, offset, SEEK_SET);
+        track.producerGeneration = requested;
+        track.endOfFile = false;
+    }
+
+    if (track.endOfFile) return false;
+
+    bool didWork = false;
+    GhostSample sample;
+    sample.generation = track.producerGeneration;
+
+    for (size_t i = 0; i < FRAMES_PER_PASS && !track.queue.full(); i++) {
+        if (std::fread(&sample.frame, sizeof(sample.frame), 1, track.file) != 1) {
+            track.endOfFile = true;
+            break;
+        }
+        track.queue.push(sample);
+        didWork = true;
+    }
+
+    return didWork;
+}
+
+long GhostStreamer::findFrame(Track& track, double time) {
+    // Frames may be stamped at the end of their step rather than at
+    // index * timeStep, so bisect on the recorded times, reading one per probe.
+    long low = 0;
+    long high = track.frameCount;
+    while (low < high) {
+        long mid = low + (high - low) / 2;
+        long offset = static_cast<long>(sizeof(TelemetryHeader) + mid * sizeof(TelemetryFrame) +
+                                        offsetof(TelemetryFrame, time));
+        double frameTime;
+        if (std::fseek(track.file, offset, SEEK_SET) != 0 ||
+            std::fread(&frameTime, sizeof(frameTime), 1, track.file) != 1) {
+            break;
+        }
+        if (time < frameTime) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return std::max(0L, low - 1);
+}
+
+void GhostStreamer::run() {
+    while (running) {
+        bool didWork = false;
+        for (auto& track : tracks) {
+            didWork |= fillTrack(*track);
+        }
+
+        if (!didWork) {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            if (running) {
+                wake.wait_for(lock, std::chrono::milliseconds(5));
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include "telemetry/RewindBuffer.h"
+
+#include <algorithm>
+
+#include "config/PhysicsConstants.h"
+#include "vehicle/Car.h"
+
+RewindBuffer::RewindBuffer(int keyframeInterval, size_t memoryBudget)
+    : keyframeInterval(std::max(1, keyframeInterval)), memoryBudget(memoryBudget),
+      memoryUsage(0), currentStep(0) {}
+
+size_t RewindBuffer::segmentSize() const {
+    return sizeof(Segment) + keyframeInterval * sizeof(VehicleInput);
+}
+
+void RewindBuffer::record(const Car& car, const VehicleInput& input) {
+    if (segments.empty() || segments.back().inputs.size() >= static_cast<size_t>(keyframeInterval)) {
+        Segment segment;
+        segment.startStep = currentStep;
+        segment.keyframe = car.captureTelemetry(currentStep * PhysicsConstants::TIME_INTERVAL);
+        segment.inputs.reserve(keyframeInterval);
+        segments.push_back(std::move(segment));
+
+        memoryUsage += segmentSize();
+        enforceBudget();
+    }
+
+    segments.back().inputs.push_back(input);
+    currentStep++;
+}
+
+bool RewindBuffer::rewindTo(Car& car, long targetStep) {
+    if (segments.empty() || targetStep < getOldestStep() || targetStep > currentStep) {
+        return false;
+    }
+
+    while (segments.back().startStep > targetStep) {
+        segments.pop_back();
+        memoryUsage -= segmentSize();
+    }
+
+    Segment& segment = segments.back();
+    size_t replaySteps = static_cast<size_t>(targetStep - segment.startStep);
+
+    car.applyTelemetry(segment.keyframe);
+    for (size_t i = 0; i < replaySteps; i++) {
+        car.step(segment.inputs[i]);
+    }
+
+    segment.inputs.resize(replaySteps);
+    if (segment.inputs.empty()) {
+        segments.pop_back();
+        memoryUsage -= segmentSize();
+    }
+
+    currentStep = targetStep;
+    return true;
+}
+
+void RewindBuffer::clear() {
+    segments.clear();
+    memoryUsage = 0;
+}
+
+long RewindBuffer::getOldestStep() const {
+    return segments.empty() ? currentStep : segments.front().startStep;
+}
+
+void RewindBuffer::enforceBudget() {
+    while (segments.size() > 1 && memoryUsage > memoryBudget) {
+        segments.pop_front();
+        memoryUsage -= segmentSize();
+    }
+}
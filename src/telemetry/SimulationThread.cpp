@@ -0,0 +1,135 @@
+#include "telemetry/SimulationThread.h"
+#include "telemetry/RewindBuffer.h"
+#include "telemetry/TelemetryRecorder.h"
+#include "vehicle/Car.h"
+#include "config/PhysicsConstants.h"
+#include "config/UIConstants.h"
+#include <algorithm>
+#include <chrono>
+
+SimulationThread::SimulationThread(Car& car, RewindBuffer& rewind, TelemetryRecorder& recorder)
+    : car(car), rewind(rewind), recorder(recorder), inputs(INPUT_QUEUE_SIZE),
+      simTime(0.0), lastInputTime(0.0), rewindCount(0), stepCount(0), running(false) {}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::start() {
+    if (running) return;
+    running = true;
+    worker = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop() {
+    if (!running) return;
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+double SimulationThread::clockSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool SimulationThread::pushInput(const InputEvent& event) {
+    return inputs.push(event);
+}
+
+int SimulationThread::applyInputs(double wallTime) {
+    int rewinds = 0;
+    const InputEvent* event;
+    while ((event = inputs.front()) != nullptr && event->time <= wallTime) {
+        switch (event->channel) {
+            case InputEvent::THROTTLE: heldInput.throttle = event->value; break;
+            case InputEvent::BRAKE: heldInput.brake = event->value; break;
+            case InputEvent::STEERING: heldInput.steering = event->value; break;
+            case InputEvent::CLUTCH: heldInput.clutchHeld = event->value > 0.5f ? 1 : 0; break;
+            case InputEvent::SHIFT_UP: heldInput.shiftUps++; break;
+            case InputEvent::SHIFT_DOWN: heldInput.shiftDowns++; break;
+            case InputEvent::REWIND: rewinds++; break;
+        }
+        lastInputTime = event->time;
+        inputs.popFront();
+    }
+    return rewinds;
+}
+
+void SimulationThread::rewindCar() {
+    long steps = static_cast<long>(UIConstants::REWIND_SECONDS / PhysicsConstants::TIME_INTERVAL);
+    long target = std::max(rewind.getOldestStep(), rewind.getCurrentStep() - steps);
+
+    if (rewind.rewindTo(car, target)) {
+        simTime = target * PhysicsConstants::TIME_INTERVAL;
+        rewindCount++;
+    }
+}
+
+void SimulationThread::step(double wallTime) {
+    int rewinds = applyInputs(wallTime);
+    for (int i = 0; i < rewinds; i++) {
+        rewindCar();
+    }
+
+    rewind.record(car, heldInput);
+    car.applyInput(heldInput);
+
+    // Published between forces and integration, which is what the serial
+    // loop used to draw. A multi-rate car integrates inside the step, so its
+    // state is published at the end of it.
+    bool multiRate = car.isMultiRate();
+    if (multiRate) {
+        car.stepSubsystems();
+        simTime += PhysicsConstants::TIME_INTERVAL;
+    } else {
+        car.computeForces();
+    }
+
+    heldInput.shiftUps = 0;
+    heldInput.shiftDowns = 0;
+
+    if (recorder.isOpen()) {
+        // Stamped with the time of the state it holds: the end of the step
+        // for a multi-rate car.
+        double frameTime = recorder.getFrameCount() * PhysicsConstants::TIME_INTERVAL;
+        if (multiRate) {
+            frameTime += PhysicsConstants::TIME_INTERVAL;
+        }
+        recorder.record(car, frameTime);
+    }
+
+    Snapshot& snapshot = snapshots.writeBuffer();
+    snapshot.frame = car.captureTelemetry(simTime);
+    snapshot.step = rewind.getCurrentStep();
+    snapshot.rewindCount = rewindCount;
+    snapshot.inputTime = lastInputTime;
+    snapshots.publish();
+
+    if (!multiRate) {
+        car.integrate();
+        simTime += PhysicsConstants::TIME_INTERVAL;
+    }
+    stepCount++;
+}
+
+void SimulationThread::run() {
+    using Clock = std::chrono::steady_clock;
+    const auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(PhysicsConstants::TIME_INTERVAL));
+    // After a long stall (debugger, suspended laptop) resume at the current
+    // time instead of running a burst of catch-up steps.
+    const auto maxLag = interval * 15;
+
+    auto next = Clock::now();
+    while (running) {
+        step(std::chrono::duration<double>(next.time_since_epoch()).count());
+
+        next += interval;
+        auto now = Clock::now();
+        if (now - next > maxLag) {
+            next = now;
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
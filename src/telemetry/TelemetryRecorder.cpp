@@ -0,0 +1,52 @@
+#include "telemetry/TelemetryRecorder.h"
+
+#include <cstring>
+
+#include "vehicle/Car.h"
+
+TelemetryRecorder::TelemetryRecorder() : file(nullptr), frameCount(0) {}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    close();
+}
+
+bool TelemetryRecorder::open(const std::string& path, double timeStep) {
+    close();
+
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    TelemetryHeader header{};
+    std::memcpy(header.magic, Telemetry::MAGIC, sizeof(header.magic));
+    header.version = Telemetry::VERSION;
+    header.frameSize = sizeof(TelemetryFrame);
+    header.timeStep = timeStep;
+
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TelemetryRecorder::close() {
+    if (file != nullptr) {
+        std::fclose(file);
+        file = nullptr;
+    }
+    frameCount = 0;
+}
+
+void TelemetryRecorder::record(const Car& car, double time) {
+    record(car.captureTelemetry(time));
+}
+
+void TelemetryRecorder::record(const TelemetryFrame& frame) {
+    if (file == nullptr) return;
+
+    if (std::fwrite(&frame, sizeof(frame), 1, file) == 1) {
+        frameCount++;
+    }
+}
@@ -0,0 +1,119 @@
+#include "telemetry/TelemetryReplay.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+TelemetryReplay::TelemetryReplay()
+    : header(nullptr), frames(nullptr), frameCount(0),
+      playhead(0.0), speed(1.0), paused(false), currentIndex(0) {}
+
+bool TelemetryReplay::open(const std::string& path) {
+    close();
+
+    if (!file.open(path)) {
+        return false;
+    }
+
+    if (file.size() < sizeof(TelemetryHeader)) {
+        close();
+        return false;
+    }
+
+    header = reinterpret_cast<const TelemetryHeader*>(file.data());
+    if (std::memcmp(header->magic, Telemetry::MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != Telemetry::VERSION ||
+        header->frameSize != sizeof(TelemetryFrame)) {
+        close();
+        return false;
+    }
+
+    // A trailing partial frame (e.g. the app was killed mid-write) is ignored.
+    frameCount = (file.size() - sizeof(TelemetryHeader)) / sizeof(TelemetryFrame);
+    if (frameCount == 0) {
+        close();
+        return false;
+    }
+
+    frames = reinterpret_cast<const TelemetryFrame*>(file.data() + sizeof(TelemetryHeader));
+    playhead = frames[0].time;
+    currentIndex = 0;
+    return true;
+}
+
+void TelemetryReplay::close() {
+    file.close();
+    header = nullptr;
+    frames = nullptr;
+    frameCount = 0;
+    playhead = 0.0;
+    currentIndex = 0;
+}
+
+size_t TelemetryReplay::findFrame(double time) const {
+    if (frameCount == 0) return 0;
+
+    const TelemetryFrame* end = frames + frameCount;
+    const TelemetryFrame* it = std::upper_bound(frames, end, time,
+        [](double t, const TelemetryFrame& frame) { return t < frame.time; });
+
+    if (it == frames) return 0;
+    return static_cast<size_t>(it - frames) - 1;
+}
+
+double TelemetryReplay::getStartTime() const {
+    return frameCount > 0 ? frames[0].time : 0.0;
+}
+
+double TelemetryReplay::getEndTime() const {
+    return frameCount > 0 ? frames[frameCount - 1].time : 0.0;
+}
+
+double TelemetryReplay::getTimeStep() const {
+    return header != nullptr ? header->timeStep : 0.0;
+}
+
+void TelemetryReplay::update(double realTimeInterval) {
+    if (paused || frameCount == 0) return;
+
+    seek(playhead + realTimeInterval * speed);
+
+    if (playhead >= getEndTime() || playhead <= getStartTime()) {
+        paused = true;
+    }
+}
+
+void TelemetryReplay::seek(double time) {
+    if (frameCount == 0) return;
+
+    playhead = std::clamp(time, getStartTime(), getEndTime());
+    currentIndex = findFrame(playhead);
+}
+
+void TelemetryReplay::seekRelative(double offset) {
+    seek(playhead + offset);
+}
+
+void TelemetryReplay::stepFrames(int count) {
+    if (frameCount == 0) return;
+
+    long target = static_cast<long>(currentIndex) + count;
+    target = std::clamp(target, 0L, static_cast<long>(frameCount) - 1);
+
+    currentIndex = static_cast<size_t>(target);
+    playhead = frames[currentIndex].time;
+}
+
+void TelemetryReplay::setSpeed(double speed) {
+    double magnitude = std::clamp(std::abs(speed), 1.0 / 16.0, 64.0);
+    this->speed = std::copysign(magnitude, speed);
+}
+
+void TelemetryReplay::togglePause() {
+    if (paused && speed > 0.0 && playhead >= getEndTime()) {
+        seek(getStartTime());
+    } else if (paused && speed < 0.0 && playhead <= getStartTime()) {
+        seek(getEndTime());
+    }
+    paused = !paused;
+}
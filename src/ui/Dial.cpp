@@ -1,15 +1,13 @@
 #include "ui/Dial.h"
+#include "ui/TextRenderer.h"
 #include <cmath>
-#include <sstream>
-#include <iomanip>
 #include <algorithm>
 
 Dial::Dial(double minValue, double maxValue, const std::string& label, const std::string& unit)
     : minValue(minValue), maxValue(maxValue), currentValue(minValue), displayValue(minValue),
       label(label), unit(unit), startAngle(-225.0 * M_PI / 180.0), endAngle(45.0 * M_PI / 180.0),
-      smoothingFactor(0.15), backgroundTexture(nullptr), cachedRadius(0),
-      labelTexture(nullptr), labelWidth(0), labelHeight(0),
-      unitTexture(nullptr), unitWidth(0), unitHeight(0) {
+      smoothingFactor(0.15), backgroundTexture(nullptr), cachedRadius(0) {
+    refreshReadout();
 }
 
 Dial::~Dial() {
@@ -21,20 +19,6 @@ void Dial::clearCache() {
         SDL_DestroyTexture(backgroundTexture);
         backgroundTexture = nullptr;
     }
-    if (labelTexture != nullptr) {
-        SDL_DestroyTexture(labelTexture);
-        labelTexture = nullptr;
-    }
-    if (unitTexture != nullptr) {
-        SDL_DestroyTexture(unitTexture);
-        unitTexture = nullptr;
-    }
-    for (auto& entry : valueCache) {
-        if (entry.second != nullptr) {
-            SDL_DestroyTexture(entry.second);
-        }
-    }
-    valueCache.clear();
 }
 
 void Dial::setValue(double value) {
@@ -46,7 +30,7 @@ double Dial::lerp(double a, double b, double t) {
     return a + (b - a) * t;
 }
 
-double Dial::valueToAngle(double value) {
+double Dial::valueToAngle(double value) const {
     double normalized = (value - minValue) / (maxValue - minValue);
     return startAngle + normalized * (endAngle - startAngle);
 }
@@ -108,8 +92,8 @@ void Dial::drawTicks(SDL_Renderer* renderer, int centerX, int centerY, int radiu
     drawArc(renderer, centerX, centerY, radius - 25, startAngle, endAngle, 80);
 }
 
-void Dial::drawNumbers(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font) {
-    if (font == nullptr) return;
+void Dial::drawNumbers(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
+    if (text == nullptr) return;
 
     double range = maxValue - minValue;
     int numberInterval = 1000;
@@ -129,15 +113,16 @@ void Dial::drawNumbers(SDL_Renderer* renderer, int centerX, int centerY, int rad
         int x = centerX + static_cast<int>(textRadius * cos(angle));
         int y = centerY + static_cast<int>(textRadius * sin(angle));
 
-        std::ostringstream oss;
-        oss << static_cast<int>(value);
-        std::string text = oss.str();
-
         SDL_Color numberColor = {200, 200, 200, 255};
-        drawText(renderer, text, x - 10, y - 8, numberColor, font);
+        text->draw(renderer, std::to_string(static_cast<int>(value)), x - 10, y - 8, numberColor);
     }
 }
 
+void Dial::refreshReadout() {
+    readout.reset().appendFixed(displayValue, 0);
+    readout.commit();
+}
+
 void Dial::drawNeedle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
     double angle = valueToAngle(displayValue);
     int needleLength = radius - 20;
@@ -161,133 +146,92 @@ void Dial::drawNeedle(SDL_Renderer* renderer, int centerX, int centerY, int radi
     SDL_RenderFillRect(renderer, &innerRect);
 }
 
-void Dial::drawLabel(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font) {
-    if (font == nullptr || label.empty()) return;
-
-    if (labelTexture == nullptr) {
-        SDL_Color labelColor = {160, 160, 160, 255};
-        SDL_Surface* surface = TTF_RenderText_Blended(font, label.c_str(), labelColor);
-        if (surface != nullptr) {
-            labelTexture = SDL_CreateTextureFromSurface(renderer, surface);
-            labelWidth = surface->w;
-            labelHeight = surface->h;
-            SDL_FreeSurface(surface);
-        }
-    }
+void Dial::drawLabel(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
+    if (text == nullptr || label.empty()) return;
 
-    if (labelTexture != nullptr) {
-        int labelY = centerY + radius / 3;
-        SDL_Rect dstRect = {centerX - labelWidth / 2, labelY, labelWidth, labelHeight};
-        SDL_RenderCopy(renderer, labelTexture, nullptr, &dstRect);
-    }
+    SDL_Color labelColor = {160, 160, 160, 255};
+    text->drawCentered(renderer, label, centerX, centerY + radius / 3, labelColor);
 }
 
-void Dial::drawReadout(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font) {
-    if (font == nullptr) return;
-
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(0) << displayValue;
-    std::string valueText = oss.str();
+void Dial::drawReadout(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
+    if (text == nullptr) return;
 
     int readoutY = centerY + radius / 2;
 
-    if (valueText != lastValueText) {
-        auto it = valueCache.find(valueText);
-        if (it == valueCache.end()) {
-            SDL_Color readoutColor = {240, 240, 240, 255};
-            SDL_Surface* valueSurface = TTF_RenderText_Blended(font, valueText.c_str(), readoutColor);
-            if (valueSurface != nullptr) {
-                SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, valueSurface);
-                valueCache[valueText] = tex;
-                SDL_FreeSurface(valueSurface);
-            }
-        }
-        lastValueText = valueText;
-    }
-
-    auto it = valueCache.find(valueText);
-    if (it != valueCache.end() && it->second != nullptr) {
-        int w, h;
-        SDL_QueryTexture(it->second, nullptr, nullptr, &w, &h);
-        SDL_Rect valueRect = {centerX - w / 2, readoutY, w, h};
-        SDL_RenderCopy(renderer, it->second, nullptr, &valueRect);
-    }
-
-    if (!unit.empty()) {
-        if (unitTexture == nullptr) {
-            SDL_Color unitColor = {140, 140, 140, 255};
-            SDL_Surface* unitSurface = TTF_RenderText_Blended(font, unit.c_str(), unitColor);
-            if (unitSurface != nullptr) {
-                unitTexture = SDL_CreateTextureFromSurface(renderer, unitSurface);
-                unitWidth = unitSurface->w;
-                unitHeight = unitSurface->h;
-                SDL_FreeSurface(unitSurface);
-            }
-        }
-
-        if (unitTexture != nullptr) {
-            int unitY = readoutY + 15;
-            SDL_Rect unitRect = {centerX - unitWidth / 2, unitY, unitWidth, unitHeight};
-            SDL_RenderCopy(renderer, unitTexture, nullptr, &unitRect);
-        }
-    }
+    SDL_Color readoutColor = {240, 240, 240, 255};
+    readout.drawCentered(renderer, *text, centerX, readoutY, readoutColor);
 }
 
-void Dial::drawText(SDL_Renderer* renderer, const std::string& text, int x, int y,
-                    SDL_Color color, TTF_Font* font) {
-    if (font == nullptr || text.empty()) return;
-
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-    if (surface == nullptr) return;
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (texture == nullptr) {
-        SDL_FreeSurface(surface);
-        return;
-    }
-
-    SDL_Rect dstrect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, nullptr, &dstrect);
+void Dial::drawUnit(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
+    if (text == nullptr || unit.empty()) return;
 
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
+    SDL_Color unitColor = {140, 140, 140, 255};
+    text->drawCentered(renderer, unit, centerX, centerY + radius / 2 + 15, unitColor);
 }
 
-void Dial::renderBackground(SDL_Renderer* renderer, int radius, TTF_Font* font) {
+void Dial::renderBackground(SDL_Renderer* renderer, int radius, TextRenderer* text) {
     int size = radius * 2 + 10;
     backgroundTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
                                           SDL_TEXTUREACCESS_TARGET, size, size);
     SDL_SetTextureBlendMode(backgroundTexture, SDL_BLENDMODE_BLEND);
 
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
     SDL_SetRenderTarget(renderer, backgroundTexture);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
 
     int center = size / 2;
     drawTicks(renderer, center, center, radius);
-    drawNumbers(renderer, center, center, radius, font);
+    drawNumbers(renderer, center, center, radius, text);
 
-    SDL_SetRenderTarget(renderer, nullptr);
+    SDL_SetRenderTarget(renderer, previousTarget);
     cachedRadius = radius;
 }
 
-void Dial::draw(SDL_Renderer* renderer, int centerX, int centerY, int radius, TTF_Font* font) {
+SDL_Rect Dial::bounds(int centerX, int centerY, int radius) {
+    int size = radius * 2 + 10;
+    return {centerX - size / 2, centerY - size / 2, size, size};
+}
+
+void Dial::drawFace(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
     if (backgroundTexture == nullptr || cachedRadius != radius) {
         if (backgroundTexture != nullptr) {
             SDL_DestroyTexture(backgroundTexture);
         }
-        renderBackground(renderer, radius, font);
+        renderBackground(renderer, radius, text);
     }
 
     if (backgroundTexture != nullptr) {
-        int size = radius * 2 + 10;
-        SDL_Rect destRect = {centerX - size/2, centerY - size/2, size, size};
+        SDL_Rect destRect = bounds(centerX, centerY, radius);
         SDL_RenderCopy(renderer, backgroundTexture, nullptr, &destRect);
     }
 
+    drawLabel(renderer, centerX, centerY, radius, text);
+    drawUnit(renderer, centerX, centerY, radius, text);
+}
+
+void Dial::drawDynamic(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     drawNeedle(renderer, centerX, centerY, radius);
-    drawLabel(renderer, centerX, centerY, radius, font);
-    drawReadout(renderer, centerX, centerY, radius, font);
-}
\ No newline at end of file
+    drawReadout(renderer, centerX, centerY, radius, text);
+}
+
+uint64_t Dial::getDynamicSignature(int radius) const {
+    // Needle end points as drawNeedle() rounds them, relative to the centre.
+    double angle = valueToAngle(displayValue);
+    int needleLength = radius - 20;
+    int needleTailLength = 20;
+    uint64_t tipX = static_cast<uint16_t>(static_cast<int>(needleLength * cos(angle)));
+    uint64_t tipY = static_cast<uint16_t>(static_cast<int>(needleLength * sin(angle)));
+    uint64_t tailX = static_cast<uint8_t>(static_cast<int>(needleTailLength * cos(angle)));
+    uint64_t tailY = static_cast<uint8_t>(static_cast<int>(needleTailLength * sin(angle)));
+    uint64_t readoutRevision = static_cast<uint16_t>(readout.getRevision());
+    return tipX | tipY << 16 | tailX << 32 | tailY << 40 | readoutRevision << 48;
+}
+
+void Dial::draw(SDL_Renderer* renderer, int centerX, int centerY, int radius, TextRenderer* text) {
+    drawFace(renderer, centerX, centerY, radius, text);
+    drawDynamic(renderer, centerX, centerY, radius, text);
+}
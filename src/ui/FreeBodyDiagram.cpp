@@ -6,6 +6,7 @@ FreeBodyDiagram::FreeBodyDiagram() : font(nullptr), visible(true), fontSize(16)
 }
 
 FreeBodyDiagram::~FreeBodyDiagram() {
+    text.setFont(nullptr);
     if (font != nullptr) {
         TTF_CloseFont(font);
     }
@@ -38,6 +39,8 @@ bool FreeBodyDiagram::initialize(const char* fontPath, int fontSize) {
         return false;
     }
 
+    text.setFont(font);
+
     return true;
 }
 
@@ -110,24 +113,7 @@ void FreeBodyDiagram::drawArrowHead(SDL_Renderer* renderer, int tipX, int tipY,
 }
 
 void FreeBodyDiagram::drawText(SDL_Renderer* renderer, const std::string& text, int x, int y, SDL_Color color) {
-    if (font == nullptr || text.empty()) return;
-
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-    if (surface == nullptr) {
-        return;
-    }
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (texture == nullptr) {
-        SDL_FreeSurface(surface);
-        return;
-    }
-
-    SDL_Rect dstrect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, nullptr, &dstrect);
-
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
+    this->text.draw(renderer, text, x, y, color);
 }
 
 SDL_Color FreeBodyDiagram::getForceColor(const std::string& forceName) {
@@ -1,11 +1,19 @@
 #include "ui/GUI.h"
 #include "config/PhysicsConstants.h"
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+
+namespace {
+    constexpr Uint32 NEVER_REFRESHED = std::numeric_limits<Uint32>::max();
+    constexpr int NO_GEAR_SHOWN = std::numeric_limits<int>::min();
+}
 
 GUI::GUI() : font(nullptr), dialFont(nullptr), visible(true), showGraphs(true), showDials(true), fontSize(16),
              currentThrottle(0.0), currentBrake(0.0), currentSteering(0.0), currentClutch(0.0),
+             replayTimelineRect{0, 0, 0, 0},
+             hudRefreshInterval(0), lastHudRefresh(NEVER_REFRESHED), lastReplayRefresh(NEVER_REFRESHED), shownGear(NO_GEAR_SHOWN),
+             latencySamples{}, latencyCount(0),
              rpmDial(0.0, 8000.0, "RPM", ""),
              torqueDial(0.0, 400.0, "TORQUE", "Nm"),
              airFlowDial(0.0, 0.05, "AIR FLOW", "kg/s"),
@@ -23,10 +31,12 @@ GUI::GUI() : font(nullptr), dialFont(nullptr), visible(true), showGraphs(true),
     graphs.emplace_back("FR Grip", SDL_Color{255, 150, 100, 255}, 0.0, 1.0);
     graphs.emplace_back("RL Grip", SDL_Color{200, 100, 255, 255}, 0.0, 1.0);
     graphs.emplace_back("RR Grip", SDL_Color{150, 100, 255, 255}, 0.0, 1.0);
+    setHudRefreshRate(UIConstants::HUD_REFRESH_HZ);
 }
 
 GUI::~GUI() {
-    clearTextCache();
+    text.setFont(nullptr);
+    dialText.setFont(nullptr);
     if (font != nullptr) {
         TTF_CloseFont(font);
     }
@@ -35,15 +45,6 @@ GUI::~GUI() {
     }
 }
 
-void GUI::clearTextCache() {
-    for (auto& entry : textCache) {
-        if (entry.second.texture != nullptr) {
-            SDL_DestroyTexture(entry.second.texture);
-        }
-    }
-    textCache.clear();
-}
-
 bool GUI::initialize(const char* fontPath, int fontSize) {
     this->fontSize = fontSize;
 
@@ -86,6 +87,7 @@ bool GUI::initialize(const char* fontPath, int fontSize) {
     }
 
     TTF_SetFontHinting(font, TTF_HINTING_LIGHT);
+    text.setFont(font);
 
     int dialFontSize = std::max(10, fontSize / 2);
     if (fontPath != nullptr) {
@@ -118,113 +120,96 @@ bool GUI::initialize(const char* fontPath, int fontSize) {
 
     if (dialFont != nullptr) {
         TTF_SetFontHinting(dialFont, TTF_HINTING_LIGHT);
+        dialText.setFont(dialFont);
     }
 
     return true;
 }
 
 void GUI::drawText(SDL_Renderer* renderer, const std::string& text, int x, int y, SDL_Color color) {
-    if (font == nullptr || text.empty()) return;
+    this->text.draw(renderer, text, x, y, color);
+}
 
-    std::string cacheKey = text + "_" + std::to_string(color.r) + "_" + std::to_string(color.g) + "_" + std::to_string(color.b);
+void GUI::setHudRefreshRate(double hz) {
+    hudRefreshInterval = hz > 0.0 ? static_cast<Uint32>(std::lround(1000.0 / hz)) : 0;
+}
 
-    auto it = textCache.find(cacheKey);
-    if (it != textCache.end()) {
-        SDL_Rect dstrect = {x, y, it->second.width, it->second.height};
-        SDL_RenderCopy(renderer, it->second.texture, nullptr, &dstrect);
-        return;
+bool GUI::refreshDue(Uint32& lastRefresh) const {
+    Uint32 now = SDL_GetTicks();
+    if (lastRefresh != NEVER_REFRESHED && now - lastRefresh < hudRefreshInterval) {
+        return false;
     }
+    lastRefresh = now;
+    return true;
+}
 
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-    if (surface == nullptr) {
-        return;
+void GUI::refreshHudText(const Car& car) {
+    speedLine.reset().appendFixed(car.velocity.norm() * 3.6, 1).append(" km/h");
+    speedLine.commit();
+
+    latencyLine.reset();
+    if (latencyCount > 0) {
+        size_t samples = std::min(latencyCount, LATENCY_WINDOW);
+        double sum = 0.0;
+        double worst = 0.0;
+        for (size_t i = 0; i < samples; i++) {
+            sum += latencySamples[i];
+            worst = std::max(worst, latencySamples[i]);
+        }
+        latencyLine.append("Input lag: ").appendFixed((sum / samples) * 1000.0, 1)
+                   .append(" ms (max ").appendFixed(worst * 1000.0, 1).append(")");
     }
+    latencyLine.commit();
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (texture == nullptr) {
-        SDL_FreeSurface(surface);
-        return;
+    for (Graph& graph : graphs) {
+        graph.refreshReadout();
+    }
+    for (Dial* dial : {&rpmDial, &torqueDial, &airFlowDial, &manifoldPressureDial,
+                       &speedDial, &volEffDial, &afrDial, &powerDial}) {
+        dial->refreshReadout();
     }
-
-    TextCacheEntry entry = {texture, surface->w, surface->h};
-    textCache[cacheKey] = entry;
-
-    SDL_Rect dstrect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, nullptr, &dstrect);
-
-    SDL_FreeSurface(surface);
 }
 
-std::vector<std::string> GUI::formatCarStats(const Car& car, double throttle) {
-    std::vector<std::string> stats;
-    std::ostringstream oss;
-
-    const Engine& engine = car.getEngine();
-    const Gearbox& gearbox = car.getGearbox();
-
-    stats.push_back("--- Vehicle ---");
-
-    oss << std::fixed << std::setprecision(1);
-    oss << "Position: (" << car.pos_x << ", " << car.pos_y << ")";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    oss << "Velocity: (" << car.velocity.x() << ", " << car.velocity.y() << ")";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    double accel_mag = car.acceleration.norm();
-    oss << "Acceleration: " << accel_mag << " m/s²";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    double angleDeg = car.angular_position * PhysicsConstants::RAD_TO_DEG;
-    while (angleDeg < 0) angleDeg += 360;
-    while (angleDeg >= 360) angleDeg -= 360;
-    oss << "Angle: " << angleDeg << "°";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    oss << std::setprecision(2);
-    oss << "Angular Vel: " << car.angular_velocity << " rad/s";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    oss << std::setprecision(1);
-    oss << "Forces: (" << car.forces.x() << ", " << car.forces.y() << ")";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    oss << std::setprecision(1);
-    oss << "Torque: " << car.angular_torque << " N·m";
-    stats.push_back(oss.str());
-    oss.str("");
-
-    stats.push_back("");
-    stats.push_back("--- Tire Load ---");
-
-    oss << std::setprecision(0);
-    oss << "FL: " << car.frontLeft->normalForce << "N";
-    stats.push_back(oss.str());
-    oss.str("");
+void GUI::drawHUD(SDL_Renderer* renderer, const Car& car, double throttle) {
+    if (!visible) return;
 
-    oss << "FR: " << car.frontRight->normalForce << "N";
-    stats.push_back(oss.str());
-    oss.str("");
+    if (refreshDue(lastHudRefresh)) {
+        refreshHudText(car);
+    }
+    int currentGear = car.getCurrentGear();
+    if (currentGear != shownGear) {
+        shownGear = currentGear;
+        gearLine.reset();
+        if (currentGear == -2) {
+            gearLine.append("R");
+        } else if (currentGear == -1) {
+            gearLine.append("N");
+        } else {
+            gearLine.appendInt(currentGear + 1);
+        }
+        gearLine.commit();
+    }
 
-    oss << "RL: " << car.backLeft->normalForce << "N";
-    stats.push_back(oss.str());
-    oss.str("");
+    int windowWidth, windowHeight;
+    SDL_GetRendererOutputSize(renderer, &windowWidth, &windowHeight);
 
-    oss << "RR: " << car.backRight->normalForce << "N";
-    stats.push_back(oss.str());
+    if (compositor.beginFrame(renderer, windowWidth, windowHeight)) {
+        compositor.beginChrome();
+        drawSpeedPanel(renderer, car, CHROME_PASS);
+        drawGraphs(renderer, CHROME_PASS);
+        drawDials(renderer, car, CHROME_PASS);
+        drawInputSliders(renderer, CHROME_PASS);
+        compositor.endChrome();
+    }
 
-    return stats;
+    drawSpeedPanel(renderer, car, DYNAMIC_PASS);
+    drawGraphs(renderer, DYNAMIC_PASS);
+    drawDials(renderer, car, DYNAMIC_PASS);
+    drawInputSliders(renderer, DYNAMIC_PASS);
+    compositor.present();
 }
 
-void GUI::drawHUD(SDL_Renderer* renderer, const Car& car, double throttle) {
-    if (!visible) return;
-
+void GUI::drawSpeedPanel(SDL_Renderer* renderer, const Car& car, HudPass pass) {
     int windowWidth, windowHeight;
     SDL_GetRendererOutputSize(renderer, &windowWidth, &windowHeight);
 
@@ -233,8 +218,6 @@ void GUI::drawHUD(SDL_Renderer* renderer, const Car& car, double throttle) {
     int marginX = std::max(5, windowWidth / 200);
     int marginY = std::max(5, windowHeight / 200);
 
-    int currentGear = car.getCurrentGear();
-
     int speedPanelWidth = std::max(180, windowWidth / 7);
     int speedPanelHeight = lineHeight * 6;
     int speedPanelX = windowWidth - speedPanelWidth - marginX;
@@ -246,44 +229,60 @@ void GUI::drawHUD(SDL_Renderer* renderer, const Car& car, double throttle) {
     int speedPanelY = dialBottomY + padding * 2;
 
     SDL_Rect speedPanel = {speedPanelX, speedPanelY, speedPanelWidth, speedPanelHeight};
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
-    SDL_RenderFillRect(renderer, &speedPanel);
-    SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
-    SDL_RenderDrawRect(renderer, &speedPanel);
-
-    std::ostringstream speedOss;
-    speedOss << std::fixed << std::setprecision(1) << (car.velocity.norm() * 3.6);
-    std::string speedText = speedOss.str();
-
     int speedTextX = speedPanelX + padding;
     int speedTextY = speedPanelY + padding;
+    int gearTextY = speedTextY + lineHeight * 3;
+    int lineWidth = speedPanelWidth - padding * 2;
 
-    drawText(renderer, "SPEED", speedTextX, speedTextY, {208, 208, 208, 255});
-    drawText(renderer, speedText + " km/h", speedTextX, speedTextY + lineHeight, {79, 163, 99, 255});
+    int indicatorY = speedPanel.y + speedPanel.h + padding;
+    int indicatorBarWidth = speedPanelWidth - 50;
+    int latencyY = indicatorY + lineHeight * 2 + padding;
+
+    if (pass == CHROME_PASS) {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
+        SDL_RenderFillRect(renderer, &speedPanel);
+        SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
+        SDL_RenderDrawRect(renderer, &speedPanel);
+
+        drawText(renderer, "SPEED", speedTextX, speedTextY, {208, 208, 208, 255});
+        drawText(renderer, "GEAR", speedTextX, gearTextY, {208, 208, 208, 255});
+        drawAssistIndicators(renderer, speedPanelX, indicatorY, 0.0, 0.0, indicatorBarWidth, pass);
+        return;
+    }
 
-    speedTextY += lineHeight * 3;
-    drawText(renderer, "GEAR", speedTextX, speedTextY, {208, 208, 208, 255});
+    SDL_Rect speedRect = {speedTextX, speedTextY + lineHeight, lineWidth, lineHeight};
+    if (compositor.beginRegion(SPEED_REGION, speedRect, speedLine.getRevision())) {
+        speedLine.draw(renderer, text, speedRect.x, speedRect.y, {79, 163, 99, 255});
+        compositor.endRegion();
+    }
 
-    if (currentGear == -2) {
-        drawText(renderer, "R", speedTextX, speedTextY + lineHeight, {194, 92, 92, 255});
-    } else if (currentGear == -1) {
-        drawText(renderer, "N", speedTextX, speedTextY + lineHeight, {208, 208, 208, 255});
-    } else {
-        std::string gearNum = std::to_string(currentGear + 1);
-        drawText(renderer, gearNum, speedTextX, speedTextY + lineHeight, {79, 163, 99, 255});
+    SDL_Rect gearRect = {speedTextX, gearTextY + lineHeight, lineWidth, lineHeight};
+    if (compositor.beginRegion(GEAR_REGION, gearRect, gearLine.getRevision())) {
+        SDL_Color gearColor = {79, 163, 99, 255};
+        if (shownGear == -2) {
+            gearColor = {194, 92, 92, 255};
+        } else if (shownGear == -1) {
+            gearColor = {208, 208, 208, 255};
+        }
+        gearLine.draw(renderer, text, gearRect.x, gearRect.y, gearColor);
+        compositor.endRegion();
     }
 
     double maxTcs, maxAbs;
     calculateSystemInterference(car, maxTcs, maxAbs);
+    drawAssistIndicators(renderer, speedPanelX, indicatorY, maxTcs, maxAbs, indicatorBarWidth, pass);
 
-    int indicatorY = speedPanel.y + speedPanel.h + padding;
-    int indicatorBarWidth = speedPanelWidth - 50;
-    drawAssistIndicators(renderer, speedPanelX, indicatorY, maxTcs, maxAbs, indicatorBarWidth);
+    SDL_Rect latencyRect = {speedPanelX, latencyY, speedPanelWidth, lineHeight};
+    if (compositor.beginRegion(LATENCY_REGION, latencyRect, latencyLine.getRevision())) {
+        latencyLine.draw(renderer, text, latencyRect.x, latencyRect.y, {160, 160, 160, 255});
+        compositor.endRegion();
+    }
+}
 
-    drawGraphs(renderer);
-    drawDials(renderer, car);
-    drawInputSliders(renderer);
+void GUI::recordInputLatency(double seconds) {
+    latencySamples[latencyCount % LATENCY_WINDOW] = seconds;
+    latencyCount++;
 }
 
 void GUI::toggleHUD() {
@@ -292,10 +291,12 @@ void GUI::toggleHUD() {
 
 void GUI::toggleGraphs() {
     showGraphs = !showGraphs;
+    compositor.invalidate();
 }
 
 void GUI::toggleDials() {
     showDials = !showDials;
+    compositor.invalidate();
 }
 
 void GUI::updateGraphs(const Car& car, double throttle, double brake, double steering) {
@@ -322,7 +323,22 @@ void GUI::updateGraphs(const Car& car, double throttle, double brake, double ste
     graphs[8].addDataPoint(car.backRight->gripLevel);
 }
 
-void GUI::drawGraphs(SDL_Renderer* renderer) {
+void GUI::clearGraphs() {
+    for (Graph& graph : graphs) {
+        graph.clear();
+    }
+}
+
+void GUI::zoomGraphs(double factor) {
+    for (Graph& graph : graphs) {
+        double samples = std::clamp(graph.getVisibleSamples() * factor,
+                                    static_cast<double>(UIConstants::GRAPH_MIN_VISIBLE_SAMPLES),
+                                    static_cast<double>(UIConstants::GRAPH_MAX_VISIBLE_SAMPLES));
+        graph.setVisibleSamples(static_cast<uint64_t>(samples));
+    }
+}
+
+void GUI::drawGraphs(SDL_Renderer* renderer, HudPass pass) {
     if (!showGraphs) return;
 
     int windowWidth, windowHeight;
@@ -347,33 +363,49 @@ void GUI::drawGraphs(SDL_Renderer* renderer) {
 
     int clutchSlipY = bottomStartY - graphHeight - graphPadding * 3;
 
-    SDL_Rect clutchSlipPanel = {
-        bottomStartX - graphPadding,
-        clutchSlipY - graphPadding,
-        graphWidth + graphPadding * 2,
-        graphHeight + graphPadding * 2
-    };
-    SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
-    SDL_RenderFillRect(renderer, &clutchSlipPanel);
-
-    graphs[3].render(renderer, bottomStartX, clutchSlipY, graphWidth, graphHeight, font);
+    auto drawGraph = [&](size_t index, int x, int y) {
+        Graph& graph = graphs[index];
+        if (pass == CHROME_PASS) {
+            graph.renderChrome(renderer, x, y, graphWidth, graphHeight, &text);
+            return;
+        }
 
-    SDL_Rect gripGraphsPanel = {
-        bottomStartX - graphPadding,
-        bottomStartY - graphPadding,
-        graphWidth + graphPadding * 2,
-        graphHeight * 4 + graphPadding * 5
+        if (!graph.prepare(renderer, graphWidth, graphHeight, &text)) return;
+        SDL_Rect bounds = {x, y, graphWidth, graphHeight};
+        if (compositor.beginRegion(GRAPH_REGION + static_cast<int>(index), bounds, graph.getRevision())) {
+            graph.renderPlot(renderer, x, y, graphWidth, graphHeight, &text);
+            compositor.endRegion();
+        }
     };
-    SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
-    SDL_RenderFillRect(renderer, &gripGraphsPanel);
 
-    graphs[5].render(renderer, bottomStartX, bottomStartY, graphWidth, graphHeight, font);
-    graphs[6].render(renderer, bottomStartX, bottomStartY + (graphHeight + graphPadding), graphWidth, graphHeight, font);
-    graphs[7].render(renderer, bottomStartX, bottomStartY + 2 * (graphHeight + graphPadding), graphWidth, graphHeight, font);
-    graphs[8].render(renderer, bottomStartX, bottomStartY + 3 * (graphHeight + graphPadding), graphWidth, graphHeight, font);
+    if (pass == CHROME_PASS) {
+        SDL_Rect clutchSlipPanel = {
+            bottomStartX - graphPadding,
+            clutchSlipY - graphPadding,
+            graphWidth + graphPadding * 2,
+            graphHeight + graphPadding * 2
+        };
+        SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
+        SDL_RenderFillRect(renderer, &clutchSlipPanel);
+
+        SDL_Rect gripGraphsPanel = {
+            bottomStartX - graphPadding,
+            bottomStartY - graphPadding,
+            graphWidth + graphPadding * 2,
+            graphHeight * 4 + graphPadding * 5
+        };
+        SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
+        SDL_RenderFillRect(renderer, &gripGraphsPanel);
+    }
+
+    drawGraph(3, bottomStartX, clutchSlipY);
+    drawGraph(5, bottomStartX, bottomStartY);
+    drawGraph(6, bottomStartX, bottomStartY + (graphHeight + graphPadding));
+    drawGraph(7, bottomStartX, bottomStartY + 2 * (graphHeight + graphPadding));
+    drawGraph(8, bottomStartX, bottomStartY + 3 * (graphHeight + graphPadding));
 }
 
-void GUI::drawDials(SDL_Renderer* renderer, const Car& car) {
+void GUI::drawDials(SDL_Renderer* renderer, const Car& car, HudPass pass) {
     if (!showDials) return;
 
     int windowWidth, windowHeight;
@@ -386,65 +418,76 @@ void GUI::drawDials(SDL_Renderer* renderer, const Car& car) {
     int marginY = std::max(10, windowHeight / 100);
     int marginX = std::max(15, windowWidth / 150);
 
-    const Engine& engine = car.getEngine();
-
     int primaryStartX = windowWidth - marginX - primaryDialRadius - (primaryDialRadius * 2 + spacing);
     int primaryStartY = marginY + primaryDialRadius;
 
-    SDL_Rect primaryDialsPanel = {
-        primaryStartX - primaryDialRadius - marginX / 2,
-        marginY - marginY / 2,
-        primaryDialRadius * 4 + spacing + marginX,
-        primaryDialRadius * 2 + marginY
-    };
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
-    SDL_RenderFillRect(renderer, &primaryDialsPanel);
-    SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
-    SDL_RenderDrawRect(renderer, &primaryDialsPanel);
-
-    speedDial.setValue(car.velocity.norm() * 3.6);
-    speedDial.draw(renderer, primaryStartX, primaryStartY, primaryDialRadius, dialFont);
-
-    rpmDial.setValue(engine.getRPM());
-    rpmDial.draw(renderer, primaryStartX + primaryDialRadius * 2 + spacing, primaryStartY, primaryDialRadius, dialFont);
-
     int secondaryStartX = windowWidth / 2 - (secondaryDialRadius * 6 + spacing * 2.5) - windowWidth / 10;
     int secondaryStartY = primaryStartY;
-
     int graphPadding = std::max(10, windowHeight / 80);
-    SDL_Rect secondaryDialsPanel = {
-        secondaryStartX - secondaryDialRadius - graphPadding,
-        secondaryStartY - secondaryDialRadius - graphPadding,
-        (secondaryDialRadius * 2 + spacing) * 5 + secondaryDialRadius * 2 + graphPadding * 2,
-        secondaryDialRadius * 2 + graphPadding * 2
-    };
-    SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
-    SDL_RenderFillRect(renderer, &secondaryDialsPanel);
-    SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
-    SDL_RenderDrawRect(renderer, &secondaryDialsPanel);
-
-    torqueDial.setValue(engine.getEngineTorque());
-    torqueDial.draw(renderer, secondaryStartX, secondaryStartY, secondaryDialRadius, dialFont);
 
-    airFlowDial.setValue(engine.getAirFlowRateValue());
-    airFlowDial.draw(renderer, secondaryStartX + secondaryDialRadius * 2 + spacing, secondaryStartY, secondaryDialRadius, dialFont);
+    if (pass == CHROME_PASS) {
+        SDL_Rect primaryDialsPanel = {
+            primaryStartX - primaryDialRadius - marginX / 2,
+            marginY - marginY / 2,
+            primaryDialRadius * 4 + spacing + marginX,
+            primaryDialRadius * 2 + marginY
+        };
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
+        SDL_RenderFillRect(renderer, &primaryDialsPanel);
+        SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
+        SDL_RenderDrawRect(renderer, &primaryDialsPanel);
+
+        SDL_Rect secondaryDialsPanel = {
+            secondaryStartX - secondaryDialRadius - graphPadding,
+            secondaryStartY - secondaryDialRadius - graphPadding,
+            (secondaryDialRadius * 2 + spacing) * 5 + secondaryDialRadius * 2 + graphPadding * 2,
+            secondaryDialRadius * 2 + graphPadding * 2
+        };
+        SDL_SetRenderDrawColor(renderer, 28, 28, 28, 200);
+        SDL_RenderFillRect(renderer, &secondaryDialsPanel);
+        SDL_SetRenderDrawColor(renderer, 60, 60, 60, 255);
+        SDL_RenderDrawRect(renderer, &secondaryDialsPanel);
+    } else {
+        const Engine& engine = car.getEngine();
+        double manifoldPressure = 101.325;
+
+        speedDial.setValue(car.velocity.norm() * 3.6);
+        rpmDial.setValue(engine.getRPM());
+        torqueDial.setValue(engine.getEngineTorque());
+        airFlowDial.setValue(engine.getAirFlowRateValue());
+        manifoldPressureDial.setValue(manifoldPressure);
+        volEffDial.setValue(engine.getVolumetricEfficiencyValue() * 100);
+        afrDial.setValue(engine.getAirFuelRatioValue());
+        powerDial.setValue(engine.getCurrentPower() / 1000.0);
+    }
 
-    double manifoldPressure = 101.325;
-    manifoldPressureDial.setValue(manifoldPressure);
-    manifoldPressureDial.draw(renderer, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 2, secondaryStartY, secondaryDialRadius, dialFont);
+    int region = DIAL_REGION;
+    auto drawDial = [&](Dial& dial, int centerX, int centerY, int radius) {
+        int id = region++;
+        if (pass == CHROME_PASS) {
+            dial.drawFace(renderer, centerX, centerY, radius, &dialText);
+            return;
+        }
 
-    volEffDial.setValue(engine.getVolumetricEfficiencyValue() * 100);
-    volEffDial.draw(renderer, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 3, secondaryStartY, secondaryDialRadius, dialFont);
+        if (compositor.beginRegion(id, Dial::bounds(centerX, centerY, radius), dial.getDynamicSignature(radius))) {
+            dial.drawDynamic(renderer, centerX, centerY, radius, &dialText);
+            compositor.endRegion();
+        }
+    };
 
-    afrDial.setValue(engine.getAirFuelRatioValue());
-    afrDial.draw(renderer, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 4, secondaryStartY, secondaryDialRadius, dialFont);
+    drawDial(speedDial, primaryStartX, primaryStartY, primaryDialRadius);
+    drawDial(rpmDial, primaryStartX + primaryDialRadius * 2 + spacing, primaryStartY, primaryDialRadius);
 
-    powerDial.setValue(engine.getCurrentPower() / 1000.0);
-    powerDial.draw(renderer, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 5, secondaryStartY, secondaryDialRadius, dialFont);
+    drawDial(torqueDial, secondaryStartX, secondaryStartY, secondaryDialRadius);
+    drawDial(airFlowDial, secondaryStartX + secondaryDialRadius * 2 + spacing, secondaryStartY, secondaryDialRadius);
+    drawDial(manifoldPressureDial, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 2, secondaryStartY, secondaryDialRadius);
+    drawDial(volEffDial, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 3, secondaryStartY, secondaryDialRadius);
+    drawDial(afrDial, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 4, secondaryStartY, secondaryDialRadius);
+    drawDial(powerDial, secondaryStartX + (secondaryDialRadius * 2 + spacing) * 5, secondaryStartY, secondaryDialRadius);
 }
 
-void GUI::drawInputSliders(SDL_Renderer* renderer) {
+void GUI::drawInputSliders(SDL_Renderer* renderer, HudPass pass) {
     int windowWidth, windowHeight;
     SDL_GetRendererOutputSize(renderer, &windowWidth, &windowHeight);
 
@@ -473,55 +516,49 @@ void GUI::drawInputSliders(SDL_Renderer* renderer) {
 
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
-    auto drawSlider = [&](const char* label, double value, int y, SDL_Color fillColor) {
-        drawText(renderer, label, startX - labelWidth - textSliderGap, y + sliderHeight / 4, {208, 208, 208, 255});
-
+    auto drawSlider = [&](int region, const char* label, double value, int y, SDL_Color fillColor, bool centered) {
         SDL_Rect background = {startX, y, sliderWidth, sliderHeight};
-        SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
-        SDL_RenderFillRect(renderer, &background);
+        if (pass == CHROME_PASS) {
+            drawText(renderer, label, startX - labelWidth - textSliderGap, y + sliderHeight / 4, {208, 208, 208, 255});
 
-        SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
-        SDL_RenderDrawRect(renderer, &background);
+            SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
+            SDL_RenderFillRect(renderer, &background);
 
-        if (value > 0.0) {
-            int fillWidth = static_cast<int>(value * sliderWidth);
-            SDL_Rect fill = {startX, y, fillWidth, sliderHeight};
-            SDL_SetRenderDrawColor(renderer, fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-            SDL_RenderFillRect(renderer, &fill);
+            SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
+            SDL_RenderDrawRect(renderer, &background);
+            return;
         }
-    };
-
-    auto drawCenteredSlider = [&](const char* label, double value, int y, SDL_Color fillColor) {
-        drawText(renderer, label, startX - labelWidth - textSliderGap, y + sliderHeight / 4, {208, 208, 208, 255});
 
-        SDL_Rect background = {startX, y, sliderWidth, sliderHeight};
-        SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
-        SDL_RenderFillRect(renderer, &background);
+        int centerX = startX + sliderWidth / 2;
+        SDL_Rect fill = {startX, y, 0, sliderHeight};
+        if (!centered) {
+            fill.w = value > 0.0 ? static_cast<int>(value * sliderWidth) : 0;
+        } else if (value < 0.0) {
+            fill.w = static_cast<int>(-value * sliderWidth / 2);
+            fill.x = centerX - fill.w;
+        } else {
+            fill.w = static_cast<int>(value * sliderWidth / 2);
+            fill.x = centerX;
+        }
 
-        SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
-        SDL_RenderDrawRect(renderer, &background);
+        uint64_t signature = static_cast<uint64_t>(static_cast<uint32_t>(fill.x)) << 32 | static_cast<uint32_t>(fill.w);
+        if (!compositor.beginRegion(region, background, signature)) return;
 
-        int centerX = startX + sliderWidth / 2;
-        if (value < 0.0) {
-            int fillWidth = static_cast<int>(-value * sliderWidth / 2);
-            SDL_Rect fill = {centerX - fillWidth, y, fillWidth, sliderHeight};
-            SDL_SetRenderDrawColor(renderer, fillColor.r, fillColor.g, fillColor.b, fillColor.a);
-            SDL_RenderFillRect(renderer, &fill);
-        } else if (value > 0.0) {
-            int fillWidth = static_cast<int>(value * sliderWidth / 2);
-            SDL_Rect fill = {centerX, y, fillWidth, sliderHeight};
+        if (fill.w > 0) {
             SDL_SetRenderDrawColor(renderer, fillColor.r, fillColor.g, fillColor.b, fillColor.a);
             SDL_RenderFillRect(renderer, &fill);
         }
-
-        SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-        SDL_RenderDrawLine(renderer, centerX, y, centerX, y + sliderHeight);
+        if (centered) {
+            SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
+            SDL_RenderDrawLine(renderer, centerX, y, centerX, y + sliderHeight);
+        }
+        compositor.endRegion();
     };
 
-    drawSlider("Throttle", currentThrottle, startY, {79, 163, 99, 255});
-    drawCenteredSlider("Steering", -currentSteering, startY + sliderHeight + sliderPadding, {75, 151, 179, 255});
-    drawSlider("Brake", currentBrake, startY + (sliderHeight + sliderPadding) * 2, {194, 92, 92, 255});
-    drawSlider("Clutch", currentClutch, startY + (sliderHeight + sliderPadding) * 3, {58, 58, 58, 255});
+    drawSlider(THROTTLE_REGION, "Throttle", currentThrottle, startY, {79, 163, 99, 255}, false);
+    drawSlider(STEERING_REGION, "Steering", -currentSteering, startY + sliderHeight + sliderPadding, {75, 151, 179, 255}, true);
+    drawSlider(BRAKE_REGION, "Brake", currentBrake, startY + (sliderHeight + sliderPadding) * 2, {194, 92, 92, 255}, false);
+    drawSlider(CLUTCH_REGION, "Clutch", currentClutch, startY + (sliderHeight + sliderPadding) * 3, {58, 58, 58, 255}, false);
 }
 
 void GUI::calculateSystemInterference(const Car& car, double& maxTcs, double& maxAbs) {
@@ -534,7 +571,7 @@ void GUI::calculateSystemInterference(const Car& car, double& maxTcs, double& ma
 }
 
 void GUI::drawAssistIndicators(SDL_Renderer* renderer, int x, int y,
-                                double maxTcs, double maxAbs, int barWidth) {
+                                double maxTcs, double maxAbs, int barWidth, HudPass pass) {
     if (font == nullptr) return;
 
     int windowWidth, windowHeight;
@@ -546,42 +583,97 @@ void GUI::drawAssistIndicators(SDL_Renderer* renderer, int x, int y,
 
     int barYOffset = (fontSize / 2) - (barHeight / 2);
 
-    auto drawBar = [&](const char* label, double value, double scale, int yPos) {
-        drawText(renderer, label, x, yPos, {200, 200, 200, 255});
-
+    auto drawBar = [&](int region, const char* label, double value, double scale, int yPos) {
         int barY = yPos + barYOffset;
         SDL_Rect barBg = {x + labelWidth, barY, barWidth, barHeight};
-        SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
-        SDL_RenderFillRect(renderer, &barBg);
+        if (pass == CHROME_PASS) {
+            drawText(renderer, label, x, yPos, {200, 200, 200, 255});
 
-        if (value > 0) {
-            int fillWidth = (int)(barWidth * std::min(value / scale, 1.0));
-            SDL_Rect barFill = {x + labelWidth, barY, fillWidth, barHeight};
+            SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
+            SDL_RenderFillRect(renderer, &barBg);
+            return;
+        }
 
-            SDL_Color color;
-            if (strcmp(label, "TCS:") == 0) {
-                if (value > 80) {
-                    color = {200, 50, 50, 255};
-                } else if (value > 40) {
-                    color = {200, 200, 50, 255};
-                } else {
-                    color = {50, 200, 50, 255};
-                }
+        int fillWidth = value > 0 ? (int)(barWidth * std::min(value / scale, 1.0)) : 0;
+
+        SDL_Color color;
+        if (strcmp(label, "TCS:") == 0) {
+            if (value > 80) {
+                color = {200, 50, 50, 255};
+            } else if (value > 40) {
+                color = {200, 200, 50, 255};
+            } else {
+                color = {50, 200, 50, 255};
+            }
+        } else {
+            if (value > 20) {
+                color = {200, 50, 50, 255};
+            } else if (value > 10) {
+                color = {200, 200, 50, 255};
             } else {
-                if (value > 20) {
-                    color = {200, 50, 50, 255};
-                } else if (value > 10) {
-                    color = {200, 200, 50, 255};
-                } else {
-                    color = {50, 200, 50, 255};
-                }
+                color = {50, 200, 50, 255};
             }
+        }
 
+        uint64_t signature = static_cast<uint64_t>(fillWidth) << 32 | color.r << 16 | color.g << 8 | color.b;
+        if (!compositor.beginRegion(region, barBg, signature)) return;
+
+        if (fillWidth > 0) {
+            SDL_Rect barFill = {x + labelWidth, barY, fillWidth, barHeight};
             SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
             SDL_RenderFillRect(renderer, &barFill);
         }
+        compositor.endRegion();
     };
 
-    drawBar("TCS:", maxTcs, 120.0, y);
-    drawBar("ABS:", maxAbs, 30.0, y + barHeight + padding);
+    drawBar(TCS_REGION, "TCS:", maxTcs, 120.0, y);
+    drawBar(ABS_REGION, "ABS:", maxAbs, 30.0, y + barHeight + padding);
+}
+
+void GUI::drawReplayTimeline(SDL_Renderer* renderer, double time, double startTime, double endTime,
+                             double speed, bool paused) {
+    int windowWidth, windowHeight;
+    SDL_GetRendererOutputSize(renderer, &windowWidth, &windowHeight);
+
+    int barWidth = windowWidth / 3;
+    int barHeight = std::max(8, windowHeight / 120);
+    int marginY = std::max(10, windowHeight / 100);
+    int lineHeight = fontSize + std::max(2, windowHeight / 250);
+
+    replayTimelineRect = {(windowWidth - barWidth) / 2, windowHeight - marginY - barHeight, barWidth, barHeight};
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 40, 40, 40, 200);
+    SDL_RenderFillRect(renderer, &replayTimelineRect);
+
+    double duration = endTime - startTime;
+    double progress = duration > 0.0 ? std::clamp((time - startTime) / duration, 0.0, 1.0) : 0.0;
+
+    SDL_Rect fill = {replayTimelineRect.x, replayTimelineRect.y,
+                     static_cast<int>(progress * barWidth), barHeight};
+    SDL_SetRenderDrawColor(renderer, 75, 151, 179, 255);
+    SDL_RenderFillRect(renderer, &fill);
+
+    SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
+    SDL_RenderDrawRect(renderer, &replayTimelineRect);
+
+    if (refreshDue(lastReplayRefresh)) {
+        replayLine.reset().append("REPLAY ").appendFixed(time - startTime, 2).append(" / ").appendFixed(duration, 2)
+                  .append(" s  x").appendFixed(speed, 2).append(paused ? "  PAUSED" : "");
+        replayLine.commit();
+    }
+    replayLine.draw(renderer, text, replayTimelineRect.x, replayTimelineRect.y - lineHeight, {208, 208, 208, 255});
+}
+
+bool GUI::getReplayTimelineFraction(int mouseX, int mouseY, double& fraction) const {
+    const SDL_Rect& bar = replayTimelineRect;
+    if (bar.w <= 0) return false;
+
+    int slack = bar.h;
+    if (mouseX < bar.x || mouseX > bar.x + bar.w || mouseY < bar.y - slack || mouseY > bar.y + bar.h + slack) {
+        return false;
+    }
+
+    fraction = std::clamp(static_cast<double>(mouseX - bar.x) / bar.w, 0.0, 1.0);
+    return true;
 }
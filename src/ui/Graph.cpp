@@ -1,89 +1,300 @@
 #include "ui/Graph.h"
+#include "ui/TextRenderer.h"
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
 #include <cmath>
+#include <utility>
 
-Graph::Graph(const std::string& label, SDL_Color color, double minValue, double maxValue, size_t maxPoints)
-    : label(label), color(color), minValue(minValue), maxValue(maxValue), maxPoints(maxPoints) {}
+Graph::Graph(const std::string& label, SDL_Color color, double minValue, double maxValue, size_t visibleSamples)
+    : label(label), color(color), minValue(minValue), maxValue(maxValue),
+      visibleSamples(std::max<uint64_t>(2, visibleSamples)), drawnColumn(-1), drawnSamples(0), revision(0),
+      cachedRenderer(nullptr), plotTexture(nullptr), chromeTexture(nullptr), cachedWidth(0), cachedHeight(0) {
+    refreshReadout();
+}
 
-void Graph::addDataPoint(double value) {
-    values.push_back(value);
-    if (values.size() > maxPoints) {
-        values.pop_front();
+Graph::~Graph() {
+    releaseTextures();
+}
+
+Graph::Graph(Graph&& other) noexcept
+    : history(std::move(other.history)), label(std::move(other.label)), color(other.color),
+      minValue(other.minValue), maxValue(other.maxValue), visibleSamples(other.visibleSamples),
+      readout(std::move(other.readout)),
+      drawnColumn(other.drawnColumn), drawnSamples(other.drawnSamples), revision(other.revision),
+      cachedRenderer(other.cachedRenderer), plotTexture(other.plotTexture), chromeTexture(other.chromeTexture),
+      cachedWidth(other.cachedWidth), cachedHeight(other.cachedHeight) {
+    other.plotTexture = nullptr;
+    other.chromeTexture = nullptr;
+    other.cachedRenderer = nullptr;
+}
+
+Graph& Graph::operator=(Graph&& other) noexcept {
+    if (this != &other) {
+        releaseTextures();
+        history = std::move(other.history);
+        label = std::move(other.label);
+        color = other.color;
+        minValue = other.minValue;
+        maxValue = other.maxValue;
+        visibleSamples = other.visibleSamples;
+        readout = std::move(other.readout);
+        drawnColumn = other.drawnColumn;
+        drawnSamples = other.drawnSamples;
+        revision = other.revision;
+        cachedRenderer = other.cachedRenderer;
+        plotTexture = other.plotTexture;
+        chromeTexture = other.chromeTexture;
+        cachedWidth = other.cachedWidth;
+        cachedHeight = other.cachedHeight;
+        other.plotTexture = nullptr;
+        other.chromeTexture = nullptr;
+        other.cachedRenderer = nullptr;
+    }
+    return *this;
+}
+
+void Graph::releaseTextures() {
+    if (plotTexture != nullptr) {
+        SDL_DestroyTexture(plotTexture);
+        plotTexture = nullptr;
+    }
+    if (chromeTexture != nullptr) {
+        SDL_DestroyTexture(chromeTexture);
+        chromeTexture = nullptr;
     }
+    cachedRenderer = nullptr;
+    cachedWidth = 0;
+    cachedHeight = 0;
+    drawnColumn = -1;
+}
+
+void Graph::addDataPoint(double value) {
+    history.append(value);
+    revision++;
 }
 
 void Graph::clear() {
-    values.clear();
+    history.clear();
+    drawnColumn = -1;
+    drawnSamples = 0;
+    revision++;
+    refreshReadout();
 }
 
-void Graph::render(SDL_Renderer* renderer, int x, int y, int width, int height, TTF_Font* font) {
-    if (values.empty()) return;
+void Graph::refreshReadout() {
+    readout.reset().appendFixed(history.getLatest(), 2);
+    readout.commit();
+}
 
-    SDL_Rect panel = {x, y, width, height};
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+void Graph::setVisibleSamples(uint64_t samples) {
+    samples = std::max<uint64_t>(2, samples);
+    if (samples == visibleSamples) return;
+    visibleSamples = samples;
+    drawnColumn = -1;
+    revision++;
+}
+
+int64_t Graph::columnForSample(uint64_t index) const {
+    return static_cast<int64_t>(index * static_cast<uint64_t>(cachedWidth) / visibleSamples);
+}
+
+uint64_t Graph::firstSampleOfColumn(int64_t column) const {
+    uint64_t width = static_cast<uint64_t>(cachedWidth);
+    return (static_cast<uint64_t>(column) * visibleSamples + width - 1) / width;
+}
+
+bool Graph::columnEnvelope(int64_t column, MinMaxPyramid::Bucket& envelope) const {
+    if (column < 0) return false;
+    uint64_t begin = firstSampleOfColumn(column);
+    uint64_t end = firstSampleOfColumn(column + 1);
+
+    // Zoomed in past one sample per column: hold the previous sample.
+    if (begin == end) {
+        if (begin == 0) return false;
+        begin--;
+    }
+    return history.query(begin, end, envelope);
+}
+
+int64_t Graph::firstVisibleColumn(int64_t lastColumn) const {
+    return lastColumn + 1 >= cachedWidth ? lastColumn + 1 - cachedWidth : 0;
+}
+
+int Graph::valueToY(double value) const {
+    double norm = (std::clamp(value, minValue, maxValue) - minValue) / (maxValue - minValue);
+    return std::clamp(cachedHeight - static_cast<int>(norm * cachedHeight), 0, cachedHeight - 1);
+}
+
+bool Graph::ensureTextures(SDL_Renderer* renderer, int width, int height, TextRenderer* text) {
+    if (plotTexture != nullptr && renderer == cachedRenderer && width == cachedWidth && height == cachedHeight) {
+        return true;
+    }
+
+    releaseTextures();
+    if (width <= 0 || height <= 0) return false;
+
+    plotTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    chromeTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (plotTexture == nullptr || chromeTexture == nullptr) {
+        releaseTextures();
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(plotTexture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureBlendMode(chromeTexture, SDL_BLENDMODE_BLEND);
+    cachedRenderer = renderer;
+    cachedWidth = width;
+    cachedHeight = height;
+
+    drawChrome(renderer, width, height, text);
+    return true;
+}
+
+void Graph::drawChrome(SDL_Renderer* renderer, int width, int height, TextRenderer* text) {
+    SDL_SetRenderTarget(renderer, chromeTexture);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
-    SDL_RenderFillRect(renderer, &panel);
+    SDL_RenderClear(renderer);
 
+    SDL_Rect border = {0, 0, width, height};
     SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
-    SDL_RenderDrawRect(renderer, &panel);
-
-    int textPadding = std::max(3, width / 60);
-
-    if (font) {
-        SDL_Surface* surface = TTF_RenderText_Blended(font, label.c_str(), {200, 200, 200, 255});
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect dstrect = {x + textPadding, y + textPadding, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &dstrect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
-        }
-    }
+    SDL_RenderDrawRect(renderer, &border);
 
     if (minValue < 0 && maxValue > 0) {
-        double zeroY = y + height - ((-minValue) / (maxValue - minValue)) * height;
+        int zeroY = height - static_cast<int>(((-minValue) / (maxValue - minValue)) * height);
         SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255);
-        SDL_RenderDrawLine(renderer, x, static_cast<int>(zeroY), x + width, static_cast<int>(zeroY));
+        SDL_RenderDrawLine(renderer, 0, zeroY, width, zeroY);
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    if (text) {
+        int textPadding = std::max(3, width / 60);
+        text->draw(renderer, label, textPadding, textPadding, {200, 200, 200, 255});
     }
+}
+
+void Graph::clearColumns(SDL_Renderer* renderer, int64_t fromPixel, int64_t toPixel) {
+    if (toPixel < fromPixel) return;
 
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
 
-    double xStep = static_cast<double>(width) / maxPoints;
-    double range = maxValue - minValue;
+    if (toPixel - fromPixel + 1 >= cachedWidth) {
+        SDL_RenderClear(renderer);
+        return;
+    }
+
+    int from = static_cast<int>(fromPixel % cachedWidth);
+    int to = static_cast<int>(toPixel % cachedWidth);
+    if (from <= to) {
+        SDL_Rect rect = {from, 0, to - from + 1, cachedHeight};
+        SDL_RenderFillRect(renderer, &rect);
+    } else {
+        SDL_Rect tail = {from, 0, cachedWidth - from, cachedHeight};
+        SDL_Rect head = {0, 0, to + 1, cachedHeight};
+        SDL_RenderFillRect(renderer, &tail);
+        SDL_RenderFillRect(renderer, &head);
+    }
+}
 
-    for (size_t i = 1; i < values.size(); i++) {
-        double val1 = std::clamp(values[i - 1], minValue, maxValue);
-        double val2 = std::clamp(values[i], minValue, maxValue);
+void Graph::drawNewColumns(SDL_Renderer* renderer) {
+    uint64_t total = history.getSampleCount();
+    if (drawnColumn >= 0 && drawnSamples == total) return;
 
-        double norm1 = (val1 - minValue) / range;
-        double norm2 = (val2 - minValue) / range;
+    int64_t lastColumn = columnForSample(total - 1);
+    int64_t start = firstVisibleColumn(lastColumn);
 
-        int x1 = x + static_cast<int>((i - 1) * xStep);
-        int y1 = y + height - static_cast<int>(norm1 * height);
-        int x2 = x + static_cast<int>(i * xStep);
-        int y2 = y + height - static_cast<int>(norm2 * height);
+    SDL_SetRenderTarget(renderer, plotTexture);
 
-        SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+    // Too far behind to continue from the last drawn column: redraw the window.
+    if (drawnColumn < start) {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+    } else {
+        start = drawnColumn;
     }
 
-    if (!values.empty() && font) {
-        std::ostringstream oss;
-        oss << std::fixed << std::setprecision(2) << values.back();
-        int valueTextOffset = std::max(30, width / 6);
+    MinMaxPyramid::Bucket previous{0.0, 0.0};
+    bool hasPrevious = columnEnvelope(start - 1, previous);
+
+    for (int64_t column = start; column <= lastColumn; column++) {
+        clearColumns(renderer, column, column);
+
+        MinMaxPyramid::Bucket envelope;
+        if (!columnEnvelope(column, envelope)) {
+            hasPrevious = false;
+            continue;
+        }
 
-        SDL_Surface* surface = TTF_RenderText_Blended(font, oss.str().c_str(), color);
-        if (surface) {
-            SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-            if (texture) {
-                SDL_Rect dstrect = {x + width - valueTextOffset, y + textPadding, surface->w, surface->h};
-                SDL_RenderCopy(renderer, texture, nullptr, &dstrect);
-                SDL_DestroyTexture(texture);
-            }
-            SDL_FreeSurface(surface);
+        // Stretch the column to meet the previous one so steep edges stay connected.
+        MinMaxPyramid::Bucket span = envelope;
+        if (hasPrevious) {
+            span.min = std::min(span.min, previous.max);
+            span.max = std::max(span.max, previous.min);
         }
+
+        int x = static_cast<int>(column % cachedWidth);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        SDL_RenderDrawLine(renderer, x, valueToY(span.max), x, valueToY(span.min));
+
+        previous = envelope;
+        hasPrevious = true;
     }
+
+    drawnColumn = lastColumn;
+    drawnSamples = total;
+}
+
+bool Graph::prepare(SDL_Renderer* renderer, int width, int height, TextRenderer* text) {
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    bool ready = ensureTextures(renderer, width, height, text);
+    if (ready && history.getSampleCount() > 0) {
+        drawNewColumns(renderer);
+    }
+    SDL_SetRenderTarget(renderer, previousTarget);
+    return ready;
+}
+
+void Graph::renderChrome(SDL_Renderer* renderer, int x, int y, int width, int height, TextRenderer* text) {
+    if (!prepare(renderer, width, height, text)) return;
+
+    SDL_Rect panel = {x, y, width, height};
+    SDL_RenderCopy(renderer, chromeTexture, nullptr, &panel);
+}
+
+void Graph::renderPlot(SDL_Renderer* renderer, int x, int y, int width, int height, TextRenderer* text) {
+    if (history.getSampleCount() == 0) return;
+    if (plotTexture == nullptr || width != cachedWidth || height != cachedHeight) return;
+
+    int64_t lastColumn = columnForSample(history.getSampleCount() - 1);
+    int head = static_cast<int>(firstVisibleColumn(lastColumn) % width);
+
+    SDL_Rect olderSrc = {head, 0, width - head, height};
+    SDL_Rect olderDst = {x, y, width - head, height};
+    SDL_RenderCopy(renderer, plotTexture, &olderSrc, &olderDst);
+    if (head > 0) {
+        SDL_Rect newerSrc = {0, 0, head, height};
+        SDL_Rect newerDst = {x + width - head, y, head, height};
+        SDL_RenderCopy(renderer, plotTexture, &newerSrc, &newerDst);
+    }
+
+    if (text) {
+        int textPadding = std::max(3, width / 60);
+        int valueTextOffset = std::max(30, width / 6);
+
+        readout.draw(renderer, *text, x + width - valueTextOffset, y + textPadding, color);
+    }
+}
+
+void Graph::render(SDL_Renderer* renderer, int x, int y, int width, int height, TextRenderer* text) {
+    if (history.getSampleCount() == 0) return;
+
+    renderChrome(renderer, x, y, width, height, text);
+    renderPlot(renderer, x, y, width, height, text);
+}
+
+uint64_t Graph::getRevision() const {
+    return revision + readout.getRevision();
 }
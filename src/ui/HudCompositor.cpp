@@ -0,0 +1,133 @@
+#include "ui/HudCompositor.h"
+
+HudCompositor::HudCompositor()
+    : renderer(nullptr), chromeTexture(nullptr), layerTexture(nullptr), previousTarget(nullptr),
+      width(0), height(0), chromeValid(false), direct(false), dirtyRegions(0) {}
+
+HudCompositor::~HudCompositor() {
+    releaseTextures();
+}
+
+void HudCompositor::releaseTextures() {
+    if (chromeTexture != nullptr) {
+        SDL_DestroyTexture(chromeTexture);
+        chromeTexture = nullptr;
+    }
+    if (layerTexture != nullptr) {
+        SDL_DestroyTexture(layerTexture);
+        layerTexture = nullptr;
+    }
+    chromeValid = false;
+}
+
+bool HudCompositor::ensureTextures(SDL_Renderer* renderer, int width, int height) {
+    if (chromeTexture != nullptr && this->renderer == renderer && this->width == width && this->height == height) {
+        return true;
+    }
+
+    releaseTextures();
+    this->renderer = renderer;
+    this->width = width;
+    this->height = height;
+    if (width <= 0 || height <= 0) return false;
+
+    chromeTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    layerTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (chromeTexture == nullptr || layerTexture == nullptr) {
+        SDL_Log("HUD compositing unavailable, drawing directly: %s", SDL_GetError());
+        releaseTextures();
+        return false;
+    }
+
+    // Both layers hold premultiplied colour: drawing with BLEND onto a
+    // cleared target multiplies by alpha once, so presenting must not.
+    SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+    if (SDL_SetTextureBlendMode(layerTexture, premultiplied) != 0) {
+        SDL_SetTextureBlendMode(layerTexture, SDL_BLENDMODE_BLEND);
+    }
+    return true;
+}
+
+void HudCompositor::invalidate() {
+    chromeValid = false;
+}
+
+bool HudCompositor::beginFrame(SDL_Renderer* renderer, int width, int height) {
+    dirtyRegions = 0;
+    direct = !ensureTextures(renderer, width, height);
+    if (direct) {
+        return true;
+    }
+
+    previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, layerTexture);
+    return !chromeValid;
+}
+
+void HudCompositor::beginChrome() {
+    if (direct) return;
+
+    SDL_SetRenderTarget(renderer, chromeTexture);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+}
+
+void HudCompositor::endChrome() {
+    if (direct) return;
+
+    SDL_SetRenderTarget(renderer, layerTexture);
+    restoreChrome({0, 0, width, height});
+    for (Region& region : regions) {
+        region.valid = false;
+    }
+    chromeValid = true;
+}
+
+void HudCompositor::restoreChrome(const SDL_Rect& rect) {
+    SDL_SetTextureBlendMode(chromeTexture, SDL_BLENDMODE_NONE);
+    SDL_RenderCopy(renderer, chromeTexture, &rect, &rect);
+}
+
+bool HudCompositor::beginRegion(int id, const SDL_Rect& rect, uint64_t signature) {
+    if (direct) {
+        dirtyRegions++;
+        return true;
+    }
+
+    if (id >= static_cast<int>(regions.size())) {
+        regions.resize(id + 1, Region{{0, 0, 0, 0}, 0, false});
+    }
+    Region& region = regions[id];
+    bool moved = region.rect.x != rect.x || region.rect.y != rect.y ||
+                 region.rect.w != rect.w || region.rect.h != rect.h;
+    if (region.valid && !moved && region.signature == signature) {
+        return false;
+    }
+
+    if (region.valid && moved) {
+        restoreChrome(region.rect);
+    }
+    region = {rect, signature, true};
+    dirtyRegions++;
+
+    restoreChrome(rect);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderSetClipRect(renderer, &rect);
+    return true;
+}
+
+void HudCompositor::endRegion() {
+    if (direct) return;
+    SDL_RenderSetClipRect(renderer, nullptr);
+}
+
+void HudCompositor::present() {
+    if (direct) return;
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    SDL_RenderCopy(renderer, layerTexture, nullptr, nullptr);
+}
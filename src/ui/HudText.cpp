@@ -0,0 +1,76 @@
+#include "ui/HudText.h"
+#include "ui/TextRenderer.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+HudText::HudText()
+    : scratch{}, scratchLength(0), shown{}, shownLength(0), revision(0),
+      layoutValid(false), layoutX(0), layoutY(0), layoutWidth(-1), layoutColor{0, 0, 0, 0},
+      layoutText(nullptr), layoutAtlasVersion(0) {}
+
+HudText& HudText::reset() {
+    scratchLength = 0;
+    return *this;
+}
+
+HudText& HudText::append(std::string_view text) {
+    size_t count = std::min(text.size(), CAPACITY - scratchLength);
+    std::memcpy(scratch + scratchLength, text.data(), count);
+    scratchLength += count;
+    return *this;
+}
+
+HudText& HudText::appendFixed(double value, int precision) {
+    auto result = std::to_chars(scratch + scratchLength, scratch + CAPACITY, value, std::chars_format::fixed, precision);
+    if (result.ec == std::errc()) {
+        scratchLength = result.ptr - scratch;
+    }
+    return *this;
+}
+
+HudText& HudText::appendInt(long value) {
+    auto result = std::to_chars(scratch + scratchLength, scratch + CAPACITY, value);
+    if (result.ec == std::errc()) {
+        scratchLength = result.ptr - scratch;
+    }
+    return *this;
+}
+
+bool HudText::commit() {
+    if (scratchLength == shownLength && std::memcmp(scratch, shown, scratchLength) == 0) {
+        return false;
+    }
+    std::memcpy(shown, scratch, scratchLength);
+    shownLength = scratchLength;
+    revision++;
+    layoutValid = false;
+    layoutWidth = -1;
+    return true;
+}
+
+void HudText::draw(SDL_Renderer* renderer, TextRenderer& text, int x, int y, SDL_Color color) {
+    if (shownLength == 0) return;
+
+    bool stale = !layoutValid || x != layoutX || y != layoutY || &text != layoutText ||
+                 text.getAtlasVersion() != layoutAtlasVersion ||
+                 color.r != layoutColor.r || color.g != layoutColor.g ||
+                 color.b != layoutColor.b || color.a != layoutColor.a;
+    if (stale) {
+        if (!text.layout(renderer, view(), x, y, color, vertices, indices)) return;
+        layoutValid = true;
+        layoutX = x;
+        layoutY = y;
+        layoutColor = color;
+        layoutText = &text;
+        layoutAtlasVersion = text.getAtlasVersion();
+    }
+    text.drawGeometry(renderer, vertices, indices);
+}
+
+void HudText::drawCentered(SDL_Renderer* renderer, TextRenderer& text, int centerX, int y, SDL_Color color) {
+    if (layoutWidth < 0 || &text != layoutText) {
+        layoutWidth = text.measureWidth(view());
+    }
+    draw(renderer, text, centerX - layoutWidth / 2, y, color);
+}
@@ -0,0 +1,97 @@
+#include "ui/InputMapper.h"
+#include "telemetry/SimulationThread.h"
+#include <algorithm>
+#include <cmath>
+
+InputMapper::InputMapper()
+    : leftKey(false), rightKey(false), steering(0.0f) {}
+
+double InputMapper::arrivalTime(const SDL_Event& event) {
+    double now = SimulationThread::clockSeconds();
+    Uint32 age = SDL_GetTicks() - event.common.timestamp;
+    // Timestamps are milliseconds since SDL_Init; ignore anything implausible.
+    if (age > 1000) return now;
+    return now - age / 1000.0;
+}
+
+void InputMapper::emit(std::vector<InputEvent>& out, double time, InputEvent::Channel channel, float value) {
+    out.push_back(InputEvent{time, channel, value});
+}
+
+void InputMapper::translateKey(SDL_Scancode scancode, bool pressed, double time, std::vector<InputEvent>& out) {
+    switch (scancode) {
+        case SDL_SCANCODE_W:
+            emit(out, time, InputEvent::THROTTLE, pressed ? 1.0f : 0.0f);
+            break;
+        case SDL_SCANCODE_S:
+            emit(out, time, InputEvent::BRAKE, pressed ? 1.0f : 0.0f);
+            break;
+        case SDL_SCANCODE_A:
+        case SDL_SCANCODE_D: {
+            (scancode == SDL_SCANCODE_A ? leftKey : rightKey) = pressed;
+            // Right wins when both are held, as before.
+            float value = rightKey ? -1.0f : (leftKey ? 1.0f : 0.0f);
+            if (value != steering) {
+                steering = value;
+                emit(out, time, InputEvent::STEERING, value);
+            }
+            break;
+        }
+        case SDL_SCANCODE_LSHIFT:
+            emit(out, time, InputEvent::CLUTCH, pressed ? 1.0f : 0.0f);
+            break;
+        case SDL_SCANCODE_E:
+            if (pressed) emit(out, time, InputEvent::SHIFT_UP, 1.0f);
+            break;
+        case SDL_SCANCODE_C:
+            if (pressed) emit(out, time, InputEvent::SHIFT_DOWN, 1.0f);
+            break;
+        case SDL_SCANCODE_R:
+            if (pressed) emit(out, time, InputEvent::REWIND, 1.0f);
+            break;
+        default:
+            break;
+    }
+}
+
+void InputMapper::translate(const SDL_Event& event, double time, std::vector<InputEvent>& out) {
+    switch (event.type) {
+        case SDL_KEYDOWN:
+            // Auto-repeat would re-send shifts; only rewind keeps going while held.
+            if (!event.key.repeat || event.key.keysym.scancode == SDL_SCANCODE_R) {
+                translateKey(event.key.keysym.scancode, true, time, out);
+            }
+            break;
+        case SDL_KEYUP:
+            translateKey(event.key.keysym.scancode, false, time, out);
+            break;
+        case SDL_JOYAXISMOTION: {
+            float raw = std::max(-1.0f, event.jaxis.value / 32767.0f);
+            if (event.jaxis.axis == STEERING_AXIS) {
+                float value = std::fabs(raw) < AXIS_DEADZONE ? 0.0f : -raw;
+                steering = value;
+                emit(out, time, InputEvent::STEERING, value);
+            } else if (event.jaxis.axis == THROTTLE_AXIS || event.jaxis.axis == BRAKE_AXIS) {
+                // Triggers rest at -1 and read +1 when fully pressed.
+                float value = (raw + 1.0f) * 0.5f;
+                if (value < AXIS_DEADZONE) value = 0.0f;
+                emit(out, time, event.jaxis.axis == THROTTLE_AXIS ? InputEvent::THROTTLE : InputEvent::BRAKE, value);
+            }
+            break;
+        }
+        case SDL_JOYBUTTONDOWN:
+        case SDL_JOYBUTTONUP: {
+            bool pressed = event.type == SDL_JOYBUTTONDOWN;
+            if (event.jbutton.button == CLUTCH_BUTTON) {
+                emit(out, time, InputEvent::CLUTCH, pressed ? 1.0f : 0.0f);
+            } else if (pressed && event.jbutton.button == SHIFT_UP_BUTTON) {
+                emit(out, time, InputEvent::SHIFT_UP, 1.0f);
+            } else if (pressed && event.jbutton.button == SHIFT_DOWN_BUTTON) {
+                emit(out, time, InputEvent::SHIFT_DOWN, 1.0f);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
@@ -0,0 +1,129 @@
+#include "ui/MinMaxPyramid.h"
+
+#include <algorithm>
+
+namespace {
+    void merge(MinMaxPyramid::Bucket& into, const MinMaxPyramid::Bucket& bucket) {
+        into.min = std::min(into.min, bucket.min);
+        into.max = std::max(into.max, bucket.max);
+    }
+}
+
+MinMaxPyramid::MinMaxPyramid(size_t capacity, size_t levelCount)
+    : capacity(std::max<size_t>(1, capacity)), levels(std::max<size_t>(1, levelCount)),
+      sampleCount(0), latest(0.0) {
+    uint64_t bucketSize = 1;
+    for (Level& level : levels) {
+        level.bucketSize = bucketSize;
+        bucketSize *= FANOUT;
+    }
+}
+
+void MinMaxPyramid::clear() {
+    for (Level& level : levels) {
+        level.ring.clear();
+        level.count = 0;
+        level.pendingCount = 0;
+    }
+    sampleCount = 0;
+    latest = 0.0;
+}
+
+void MinMaxPyramid::push(Level& level, const Bucket& bucket) {
+    // Rings grow up to capacity and are then overwritten in place, so short
+    // sessions don't pay for the full allocation.
+    if (level.ring.size() < capacity) {
+        level.ring.push_back(bucket);
+    } else {
+        level.ring[level.count % capacity] = bucket;
+    }
+    level.count++;
+}
+
+void MinMaxPyramid::append(double value) {
+    Bucket bucket{value, value};
+    latest = value;
+    sampleCount++;
+
+    for (size_t i = 0; i < levels.size(); i++) {
+        push(levels[i], bucket);
+        if (i + 1 == levels.size()) break;
+
+        Level& parent = levels[i + 1];
+        if (parent.pendingCount == 0) {
+            parent.pending = bucket;
+        } else {
+            merge(parent.pending, bucket);
+        }
+        if (++parent.pendingCount < FANOUT) break;
+
+        bucket = parent.pending;
+        parent.pendingCount = 0;
+    }
+}
+
+uint64_t MinMaxPyramid::getOldestSample() const {
+    const Level& top = levels.back();
+    uint64_t oldestBucket = top.count > capacity ? top.count - capacity : 0;
+    return oldestBucket * top.bucketSize;
+}
+
+size_t MinMaxPyramid::levelForSpan(uint64_t span) const {
+    size_t level = 0;
+    while (level + 1 < levels.size() && levels[level + 1].bucketSize <= span) {
+        level++;
+    }
+    return level;
+}
+
+bool MinMaxPyramid::queryLevel(size_t index, uint64_t begin, uint64_t end, Bucket& result) const {
+    const Level& level = levels[index];
+    uint64_t oldest = level.count > capacity ? level.count - capacity : 0;
+    uint64_t first = begin / level.bucketSize;
+    uint64_t last = (end - 1) / level.bucketSize;
+
+    if (first < oldest) return false;
+
+    bool found = false;
+    uint64_t lastComplete = std::min(last, level.count == 0 ? 0 : level.count - 1);
+    if (level.count > 0) {
+        for (uint64_t j = first; j <= lastComplete; j++) {
+            const Bucket& bucket = level.ring[j % capacity];
+            if (!found) {
+                result = bucket;
+                found = true;
+            } else {
+                merge(result, bucket);
+            }
+        }
+    }
+
+    // Samples past this level's last complete bucket are still in the
+    // partially filled buckets of this level and every finer one: each level's
+    // pending bucket holds the complete buckets of the level below it.
+    if (last >= level.count) {
+        for (size_t i = 1; i <= index; i++) {
+            const Level& finer = levels[i];
+            if (finer.pendingCount == 0) continue;
+            if (!found) {
+                result = finer.pending;
+                found = true;
+            } else {
+                merge(result, finer.pending);
+            }
+        }
+    }
+    return found;
+}
+
+bool MinMaxPyramid::query(uint64_t begin, uint64_t end, Bucket& result) const {
+    end = std::min(end, sampleCount);
+    if (begin >= end) return false;
+
+    for (size_t i = levelForSpan(end - begin); i < levels.size(); i++) {
+        if (queryLevel(i, begin, end, result)) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,228 @@
+#include "ui/TextRenderer.h"
+
+#include <algorithm>
+
+// Degree sign, superscript two and middle dot, used by the HUD unit strings.
+const uint32_t TextRenderer::EXTRA_CODE_POINTS[] = {0x00B0, 0x00B2, 0x00B7};
+
+namespace {
+    constexpr int ATLAS_WIDTH = 512;
+    constexpr int GLYPH_PADDING = 1;
+}
+
+TextRenderer::TextRenderer()
+    : font(nullptr), atlasRenderer(nullptr), atlas(nullptr), atlasHeight(0), lineHeight(0), atlasVersion(0) {}
+
+TextRenderer::~TextRenderer() {
+    destroyAtlas();
+}
+
+void TextRenderer::destroyAtlas() {
+    if (atlas != nullptr) {
+        SDL_DestroyTexture(atlas);
+        atlas = nullptr;
+    }
+    atlasRenderer = nullptr;
+}
+
+void TextRenderer::setFont(TTF_Font* newFont) {
+    destroyAtlas();
+    font = newFont;
+    codePoints.clear();
+    glyphs.clear();
+    lineHeight = 0;
+
+    if (font == nullptr) return;
+
+    lineHeight = TTF_FontHeight(font);
+
+    for (uint32_t cp = FIRST_ASCII; cp <= LAST_ASCII; cp++) {
+        codePoints.push_back(cp);
+    }
+    for (uint32_t cp : EXTRA_CODE_POINTS) {
+        if (TTF_GlyphIsProvided32(font, cp)) {
+            codePoints.push_back(cp);
+        }
+    }
+
+    for (uint32_t cp : codePoints) {
+        int advance = 0;
+        TTF_GlyphMetrics32(font, cp, nullptr, nullptr, nullptr, nullptr, &advance);
+        glyphs.push_back({SDL_Rect{0, 0, 0, 0}, advance});
+    }
+}
+
+bool TextRenderer::ensureAtlas(SDL_Renderer* renderer) {
+    if (font == nullptr) return false;
+    if (atlas != nullptr && atlasRenderer == renderer) return true;
+
+    destroyAtlas();
+
+    std::vector<SDL_Surface*> surfaces(codePoints.size(), nullptr);
+    int penX = 0;
+    int penY = 0;
+    int rowHeight = 0;
+
+    for (size_t i = 0; i < codePoints.size(); i++) {
+        surfaces[i] = TTF_RenderGlyph32_Blended(font, codePoints[i], SDL_Color{255, 255, 255, 255});
+        if (surfaces[i] == nullptr) {
+            glyphs[i].source = SDL_Rect{0, 0, 0, 0};
+            continue;
+        }
+
+        int w = surfaces[i]->w;
+        int h = surfaces[i]->h;
+        if (penX + w > ATLAS_WIDTH) {
+            penX = 0;
+            penY += rowHeight + GLYPH_PADDING;
+            rowHeight = 0;
+        }
+        glyphs[i].source = SDL_Rect{penX, penY, w, h};
+        penX += w + GLYPH_PADDING;
+        rowHeight = std::max(rowHeight, h);
+    }
+
+    atlasHeight = std::max(1, penY + rowHeight);
+    SDL_Surface* sheet = SDL_CreateRGBSurfaceWithFormat(0, ATLAS_WIDTH, atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+
+    if (sheet != nullptr) {
+        SDL_FillRect(sheet, nullptr, 0);
+        for (size_t i = 0; i < surfaces.size(); i++) {
+            if (surfaces[i] == nullptr) continue;
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_Rect dst = glyphs[i].source;
+            SDL_BlitSurface(surfaces[i], nullptr, sheet, &dst);
+        }
+        atlas = SDL_CreateTextureFromSurface(renderer, sheet);
+        SDL_FreeSurface(sheet);
+    }
+
+    for (SDL_Surface* surface : surfaces) {
+        if (surface != nullptr) {
+            SDL_FreeSurface(surface);
+        }
+    }
+
+    if (atlas == nullptr) {
+        SDL_Log("Failed to build glyph atlas: %s", SDL_GetError());
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+    atlasRenderer = renderer;
+    atlasVersion++;
+    return true;
+}
+
+const TextRenderer::Glyph* TextRenderer::findGlyph(uint32_t codePoint) const {
+    if (codePoint >= FIRST_ASCII && codePoint <= LAST_ASCII) {
+        size_t index = codePoint - FIRST_ASCII;
+        return index < glyphs.size() ? &glyphs[index] : nullptr;
+    }
+    for (size_t i = LAST_ASCII - FIRST_ASCII + 1; i < codePoints.size(); i++) {
+        if (codePoints[i] == codePoint) {
+            return &glyphs[i];
+        }
+    }
+    return findGlyph('?');
+}
+
+uint32_t TextRenderer::nextCodePoint(std::string_view text, size_t& index) {
+    unsigned char lead = static_cast<unsigned char>(text[index++]);
+    if (lead < 0x80) return lead;
+
+    int continuation;
+    uint32_t cp;
+    if ((lead & 0xE0) == 0xC0) {
+        continuation = 1;
+        cp = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        continuation = 2;
+        cp = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        continuation = 3;
+        cp = lead & 0x07;
+    } else {
+        return '?';
+    }
+
+    for (int i = 0; i < continuation; i++) {
+        if (index >= text.size()) return '?';
+        unsigned char byte = static_cast<unsigned char>(text[index]);
+        if ((byte & 0xC0) != 0x80) return '?';
+        cp = (cp << 6) | (byte & 0x3F);
+        index++;
+    }
+    return cp;
+}
+
+int TextRenderer::measureWidth(std::string_view text) const {
+    int width = 0;
+    size_t index = 0;
+    while (index < text.size()) {
+        const Glyph* glyph = findGlyph(nextCodePoint(text, index));
+        if (glyph != nullptr) {
+            width += glyph->advance;
+        }
+    }
+    return width;
+}
+
+bool TextRenderer::layout(SDL_Renderer* renderer, std::string_view text, int x, int y, SDL_Color color,
+                          std::vector<SDL_Vertex>& quadVertices, std::vector<int>& quadIndices) {
+    quadVertices.clear();
+    quadIndices.clear();
+    if (!ensureAtlas(renderer)) return false;
+
+    float invWidth = 1.0f / ATLAS_WIDTH;
+    float invHeight = 1.0f / atlasHeight;
+    float penX = static_cast<float>(x);
+    float top = static_cast<float>(y);
+
+    size_t index = 0;
+    while (index < text.size()) {
+        const Glyph* glyph = findGlyph(nextCodePoint(text, index));
+        if (glyph == nullptr) continue;
+
+        const SDL_Rect& src = glyph->source;
+        if (src.w > 0 && src.h > 0) {
+            float u0 = src.x * invWidth;
+            float v0 = src.y * invHeight;
+            float u1 = (src.x + src.w) * invWidth;
+            float v1 = (src.y + src.h) * invHeight;
+            float right = penX + src.w;
+            float bottom = top + src.h;
+
+            int base = static_cast<int>(quadVertices.size());
+            quadVertices.push_back({{penX, top}, color, {u0, v0}});
+            quadVertices.push_back({{right, top}, color, {u1, v0}});
+            quadVertices.push_back({{right, bottom}, color, {u1, v1}});
+            quadVertices.push_back({{penX, bottom}, color, {u0, v1}});
+
+            quadIndices.insert(quadIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        penX += glyph->advance;
+    }
+
+    return true;
+}
+
+void TextRenderer::drawGeometry(SDL_Renderer* renderer, const std::vector<SDL_Vertex>& quadVertices,
+                                const std::vector<int>& quadIndices) {
+    if (quadVertices.empty() || atlas == nullptr || atlasRenderer != renderer) return;
+
+    SDL_RenderGeometry(renderer, atlas, quadVertices.data(), static_cast<int>(quadVertices.size()),
+                       quadIndices.data(), static_cast<int>(quadIndices.size()));
+}
+
+void TextRenderer::draw(SDL_Renderer* renderer, std::string_view text, int x, int y, SDL_Color color) {
+    if (text.empty()) return;
+
+    if (layout(renderer, text, x, y, color, vertices, indices)) {
+        drawGeometry(renderer, vertices, indices);
+    }
+}
+
+void TextRenderer::drawCentered(SDL_Renderer* renderer, std::string_view text, int centerX, int y, SDL_Color color) {
+    draw(renderer, text, centerX - measureWidth(text) / 2, y, color);
+}
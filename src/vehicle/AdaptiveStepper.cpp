@@ -0,0 +1,140 @@
+#include "vehicle/AdaptiveStepper.h"
+
+#include "vehicle/Car.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Magnitudes below which the tolerance is taken as absolute rather than
+    // relative, so quantities near zero don't demand tiny steps.
+    const double VELOCITY_SCALE = 1.0;
+    const double YAW_RATE_SCALE = 0.1;
+    const double RPM_SCALE = 100.0;
+
+    const double SAFETY = 0.9;
+    const double MAX_GROWTH = 2.0;
+    const double MAX_SHRINK = 0.2;
+
+    double scaledError(double full, double halves, double scale, double tolerance) {
+        double magnitude = std::max(std::abs(full), std::abs(halves)) + scale;
+        return std::abs(full - halves) / (tolerance * magnitude);
+    }
+}
+
+AdaptiveStepper::AdaptiveStepper(Car& car, const AdaptiveStepSettings& settings)
+    : car(car), settings(settings), stepSize(settings.maxStep) {}
+
+AdaptiveStepper::DiscreteState AdaptiveStepper::discreteState() const {
+    DiscreteState state{car.getCurrentGear(), car.getGearbox().isClutchLocked(), 0, 0};
+    for (size_t i = 0; i < car.wheels.size(); i++) {
+        if (car.wheels[i]->absInterference > 0.0) {
+            state.absActive |= 1 << i;
+        }
+        if (car.wheels[i]->tcsInterference > 0.0) {
+            state.tcsActive |= 1 << i;
+        }
+    }
+    return state;
+}
+
+void AdaptiveStepper::logEvents(const DiscreteState& before, const DiscreteState& after) {
+    if (after.gear != before.gear) {
+        events.push_back({time, GEAR_CHANGE});
+    }
+    if (after.clutchLocked != before.clutchLocked) {
+        events.push_back({time, CLUTCH_LOCK});
+    }
+    if (after.absActive != before.absActive) {
+        events.push_back({time, ABS_ACTIVITY});
+    }
+    if (after.tcsActive != before.tcsActive) {
+        events.push_back({time, TCS_ACTIVITY});
+    }
+}
+
+void AdaptiveStepper::stepCar(const VehicleInput& input, double dt) {
+    car.setTimeStep(dt);
+    car.step(input);
+    evaluations++;
+}
+
+double AdaptiveStepper::errorNorm(const TelemetryFrame& full, const TelemetryFrame& halves) const {
+    double tolerance = settings.tolerance;
+    double radius = car.getParams().tire.radius;
+
+    double error = scaledError(full.velocity_x, halves.velocity_x, VELOCITY_SCALE, tolerance);
+    error = std::max(error, scaledError(full.velocity_y, halves.velocity_y, VELOCITY_SCALE, tolerance));
+    error = std::max(error, scaledError(full.angular_velocity, halves.angular_velocity, YAW_RATE_SCALE, tolerance));
+    for (int i = 0; i < 4; i++) {
+        error = std::max(error, scaledError(full.wheels[i].angular_velocity * radius,
+                                            halves.wheels[i].angular_velocity * radius,
+                                            VELOCITY_SCALE, tolerance));
+    }
+    error = std::max(error, scaledError(full.engine.rpm, halves.engine.rpm, RPM_SCALE, tolerance));
+    return error;
+}
+
+void AdaptiveStepper::advance(const VehicleInput& input, double duration) {
+    VehicleInput held = input;
+    held.shiftUps = 0;
+    held.shiftDowns = 0;
+    const VehicleInput* next = &input;
+    const double carTimeStep = car.getTimeStep();
+
+    double endTime = time + duration;
+    // End of the interval known to contain an event, or -1.
+    double eventEnd = -1.0;
+
+    while (endTime - time > 1e-9) {
+        double h = std::min(stepSize, endTime - time);
+        if (eventEnd > time) {
+            double width = eventEnd - time;
+            h = std::min(h, width <= settings.eventTolerance ? width : width / 2.0);
+        }
+
+        TelemetryFrame start = car.captureTelemetry(time);
+        DiscreteState before = discreteState();
+
+        stepCar(*next, h);
+        TelemetryFrame full = car.captureTelemetry(time + h);
+        bool event = !(discreteState() == before);
+
+        car.applyTelemetry(start);
+        stepCar(*next, h / 2.0);
+        event = event || !(discreteState() == before);
+        stepCar(held, h / 2.0);
+        DiscreteState after = discreteState();
+        event = event || !(after == before);
+
+        if (event && h > settings.eventTolerance) {
+            eventEnd = time + h;
+            car.applyTelemetry(start);
+            rejectedSteps++;
+            continue;
+        }
+
+        double error = errorNorm(full, car.captureTelemetry(time + h));
+        double factor = error > 0.0 ? std::clamp(SAFETY / std::sqrt(error), MAX_SHRINK, MAX_GROWTH) : MAX_GROWTH;
+
+        if (error > 1.0 && h > settings.minStep) {
+            stepSize = std::max(settings.minStep, h * factor);
+            car.applyTelemetry(start);
+            rejectedSteps++;
+            continue;
+        }
+
+        time += h;
+        acceptedSteps++;
+        next = &held;
+        if (event) {
+            logEvents(before, after);
+            eventEnd = -1.0;
+        }
+
+        // A step cut short by the interval end or an event says nothing
+        // against the current size unless it had to shrink.
+        double proposed = (h < stepSize && factor >= 1.0) ? stepSize : h * factor;
+        stepSize = std::clamp(proposed, settings.minStep, settings.maxStep);
+    }
+    car.setTimeStep(carTimeStep);
+}
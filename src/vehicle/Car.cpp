@@ -2,38 +2,58 @@
 #include "config/PhysicsConstants.h"
 #include "config/RenderingConstants.h"
 #include "config/EngineConstants.h"
+#include "core/FastMath.h"
 #include "rendering/Camera.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
-Car::Car(double x, double y, int w, int h)
+namespace {
+    constexpr double DEBUG_VELOCITY_SCALE = 5.0;
+    constexpr double DEBUG_ACCEL_SCALE = 20.0;
+    constexpr int DEBUG_ARROW_SIZE = 8;
+}
+
+Car::Car(double x, double y, int w, int h, const VehicleParams& params)
     : width(w), height(h),
-      gearbox({3.5, 2.2, 1.5, 1.0, 0.75, 0.6}, 4.2),
-      tcs(PhysicsConstants::TIRE_TCS_kP, PhysicsConstants::TIRE_TCS_kD),
-      abs(PhysicsConstants::ABS_kP, PhysicsConstants::ABS_kD) {
+      params(params),
+      tireModel(TireModel<double>::fromParams(params.tire)),
+      steeringGeometry(params),
+      engine(params.engine),
+      gearbox(params.gearbox),
+      tcs(params.controllers.tcsKp, params.controllers.tcsKd),
+      abs(params.controllers.absKp, params.controllers.absKd) {
     pos_x = x;
     pos_y = y;
 
-    double halfWidth = (RenderingConstants::CAR_WIDTH / 10.0) / 2.0;
-    double halfLength = (RenderingConstants::CAR_LENGTH / 10.0) / 2.0;
+    mass = params.mass;
+    moment_of_inertia = params.yawMomentOfInertia;
+    engine_power = params.enginePower;
+    braking_power = params.brakingPower;
+
+    double halfWidth = params.bodyWidth / 2.0;
+    double halfLength = params.bodyLength / 2.0;
+    double widthInset = params.wheelWidthInset;
+    double lengthInset = params.wheelLengthInset;
 
-    frontLeft = new Wheel();
-    frontLeft->position = Eigen::Vector2d(-halfWidth + RenderingConstants::WHEEL_WIDTH_INSET,
-                                           halfLength - RenderingConstants::WHEEL_LENGTH_INSET);
+    frontLeft = new Wheel(params.tire);
+    frontLeft->position = Eigen::Vector2d(-halfWidth + widthInset, halfLength - lengthInset);
 
-    frontRight = new Wheel();
-    frontRight->position = Eigen::Vector2d(halfWidth - RenderingConstants::WHEEL_WIDTH_INSET,
-                                            halfLength - RenderingConstants::WHEEL_LENGTH_INSET);
+    frontRight = new Wheel(params.tire);
+    frontRight->position = Eigen::Vector2d(halfWidth - widthInset, halfLength - lengthInset);
 
-    backLeft = new Wheel();
-    backLeft->position = Eigen::Vector2d(-halfWidth + RenderingConstants::WHEEL_WIDTH_INSET,
-                                          -halfLength + RenderingConstants::WHEEL_LENGTH_INSET);
+    backLeft = new Wheel(params.tire);
+    backLeft->position = Eigen::Vector2d(-halfWidth + widthInset, -halfLength + lengthInset);
 
-    backRight = new Wheel();
-    backRight->position = Eigen::Vector2d(halfWidth - RenderingConstants::WHEEL_WIDTH_INSET,
-                                           -halfLength + RenderingConstants::WHEEL_LENGTH_INSET);
+    backRight = new Wheel(params.tire);
+    backRight->position = Eigen::Vector2d(halfWidth - widthInset, -halfLength + lengthInset);
 
     wheels.assign({frontLeft, frontRight, backLeft, backRight});
+
+    for (Wheel* wheel : wheels) {
+        wheel->normalForce = params.mass * 9.81 / 4.0;
+    }
+    resetChassisInterval();
 }
 
 Car::~Car() {
@@ -41,10 +61,6 @@ Car::~Car() {
     delete frontRight;
     delete backLeft;
     delete backRight;
-
-    if (carTexture != nullptr) {
-        SDL_DestroyTexture(carTexture);
-    }
 }
 
 const int Car::getWidth() {
@@ -55,17 +71,46 @@ const int Car::getHeight() {
     return height;
 }
 
+double Car::contactAngle() const {
+    double t = chassisElapsed;
+    return angular_position + angular_velocity * t + 0.5 * angular_acceleration * t * t;
+}
+
 Eigen::Vector2d Car::calculateWheelVelocityLocal(Eigen::Vector2d wheelPosition) {
-    double cos_angle = cos(angular_position);
-    double sin_angle = sin(angular_position);
+    // Between chassis steps the chassis is carried forward at its last
+    // acceleration; chassisElapsed is zero otherwise.
+    double t = chassisElapsed;
+    Eigen::Vector3d chassisVelocity(velocity.x() + acceleration.x() * t,
+                                    velocity.y() + acceleration.y() * t,
+                                    angular_velocity + angular_acceleration * t);
+    return wheelVelocityLocal(wheelPosition, contactAngle(), chassisVelocity);
+}
+
+TireModel<double>::LaneForces<4> Car::evaluateTires(const std::array<Eigen::Vector2d, 4>& velocityLocal,
+                                                    double dt) const {
+    TireModel<double>::Lanes<4> angle, vx, vy, omega, load;
+    for (int i = 0; i < 4; i++) {
+        angle[i] = wheels[i]->wheelAngle;
+        vx[i] = velocityLocal[i].x();
+        vy[i] = velocityLocal[i].y();
+        omega[i] = wheels[i]->angular_velocity;
+        load[i] = wheels[i]->normalForce;
+    }
+    return tireModel.evaluateLanes<4>(angle, vx, vy, omega, load, dt);
+}
+
+Eigen::Vector2d Car::wheelVelocityLocal(const Eigen::Vector2d& wheelPosition, double angle,
+                                        const Eigen::Vector3d& chassisVelocity) {
+    double cos_angle = PhysicsMath::cos(angle);
+    double sin_angle = PhysicsMath::sin(angle);
     Eigen::Vector2d velocityLocal(
-        velocity.x() * cos_angle - velocity.y() * sin_angle,
-        velocity.x() * sin_angle + velocity.y() * cos_angle
+        chassisVelocity.x() * cos_angle - chassisVelocity.y() * sin_angle,
+        chassisVelocity.x() * sin_angle + chassisVelocity.y() * cos_angle
     );
 
     Eigen::Vector2d rotationalVelLocal(
-        -angular_velocity * wheelPosition.y(),
-        angular_velocity * wheelPosition.x()
+        -chassisVelocity.z() * wheelPosition.y(),
+        chassisVelocity.z() * wheelPosition.x()
     );
 
     return velocityLocal + rotationalVelLocal;
@@ -78,106 +123,62 @@ void Car::applySteering(double amount) {
     speedFactor = std::max(0.5, speedFactor);
 
     steering_angle += amount * speedFactor;
-    steering_angle = std::clamp(steering_angle, -PhysicsConstants::MAX_STEERING_ANGLE, PhysicsConstants::MAX_STEERING_ANGLE);
+    steering_angle = std::clamp(steering_angle, -params.maxSteeringAngle, params.maxSteeringAngle);
 
-    double wheelbase = RenderingConstants::WHEELBASE;
-    double trackWidth = RenderingConstants::TRACK_WIDTH;
-    double steeringRack = PhysicsConstants::STEERING_RACK;
-    double baseAngle = steering_angle * steeringRack;
+    steerFrontWheels();
+}
 
-    if (std::abs(baseAngle) < 0.001) {
-        frontLeft->wheelAngle = 0.0;
-        frontRight->wheelAngle = 0.0;
-    } else {
-        double turnRadius = wheelbase / std::tan(std::abs(baseAngle));
-
-        if (steering_angle > 0) {
-            double innerRadius = turnRadius - trackWidth / 2.0;
-            double outerRadius = turnRadius + trackWidth / 2.0;
-            frontLeft->wheelAngle = std::atan(wheelbase / innerRadius);
-            frontRight->wheelAngle = std::atan(wheelbase / outerRadius);
-        } else {
-            double innerRadius = turnRadius - trackWidth / 2.0;
-            double outerRadius = turnRadius + trackWidth / 2.0;
-            frontLeft->wheelAngle = -std::atan(wheelbase / outerRadius);
-            frontRight->wheelAngle = -std::atan(wheelbase / innerRadius);
-        }
-    }
+void Car::steerFrontWheels() {
+    SteeringGeometry<double>::WheelAngles angles = steeringGeometry.wheelAngles(steering_angle);
+    frontLeft->wheelAngle = angles.left;
+    frontRight->wheelAngle = angles.right;
 }
 
 void Car::applyForceFeedback()
 {
-    steering_angle *= PhysicsConstants::FORCE_FEEDBACK_DECAY;
+    steering_angle *= params.forceFeedbackDecay;
 
-    double wheelbase = RenderingConstants::WHEELBASE;
-    double trackWidth = RenderingConstants::TRACK_WIDTH;
-    double steeringRack = PhysicsConstants::STEERING_RACK;
-    double baseAngle = steering_angle * steeringRack;
-
-    if (std::abs(baseAngle) < 0.001) {
-        frontLeft->wheelAngle = 0.0;
-        frontRight->wheelAngle = 0.0;
-    } else {
-        double turnRadius = wheelbase / std::tan(std::abs(baseAngle));
-
-        if (steering_angle > 0) {
-            double innerRadius = turnRadius - trackWidth / 2.0;
-            double outerRadius = turnRadius + trackWidth / 2.0;
-            frontLeft->wheelAngle = std::atan(wheelbase / innerRadius);
-            frontRight->wheelAngle = std::atan(wheelbase / outerRadius);
-        } else {
-            double innerRadius = turnRadius - trackWidth / 2.0;
-            double outerRadius = turnRadius + trackWidth / 2.0;
-            frontLeft->wheelAngle = -std::atan(wheelbase / outerRadius);
-            frontRight->wheelAngle = -std::atan(wheelbase / innerRadius);
-        }
-    }
+    steerFrontWheels();
 }
 
 void Car::updateEngine(double throttle) {
-    gearbox.update();
+    updateEngine(throttle, timeStep);
+}
+
+void Car::updateEngine(double throttle, double dt) {
+    gearbox.update(dt);
     engine.calculateTorque(actualThrottle);
 
     Wheel* rearWheels[] = {backLeft, backRight};
 
     double avgWheelOmega = (backLeft->angular_velocity + backRight->angular_velocity) / 2.0;
 
-#ifndef __EMSCRIPTEN__
-    std::cout << "RPM: " << engine.getRPM() << " | WheelOmega: " << avgWheelOmega
-            << " | ClutchTorque: " << gearbox.getClutchTorque() << std::endl;
-#endif
-
-
-
-    double totalWheelTorque = gearbox.convertEngineTorqueToWheel(engine.getEngineTorque(), &engine, avgWheelOmega);
-    double baseTorque = totalWheelTorque;
-
-    double reflectedInertia = gearbox.getReflectedEngineInertia(EngineConstants::ENGINE_MOMENT_OF_INERTIA);
-    double wheelInertia = PhysicsConstants::WHEEL_MOMENT_OF_INERTIA;
-    double effectiveInertia = wheelInertia + reflectedInertia;
-    double inertiaCorrection = wheelInertia / effectiveInertia;
-
-#ifndef __EMSCRIPTEN__
-    static int inertiaDebugCounter = 0;
-    if (inertiaDebugCounter++ % 30 == 0 && gearbox.getCurrentGear() >= 0) {
-        std::cout << "\n=== REFLECTED INERTIA ===" << std::endl;
-        std::cout << "Wheel I: " << wheelInertia << " kg·m² | Reflected Engine I: " << reflectedInertia << " kg·m²" << std::endl;
-        std::cout << "Effective I: " << effectiveInertia << " kg·m² | Correction: " << inertiaCorrection << std::endl;
-        std::cout << "Torque Before: " << (baseTorque / inertiaCorrection) << " Nm | After: " << (baseTorque / inertiaCorrection * inertiaCorrection) << " Nm" << std::endl;
-        std::cout << "========================" << std::endl;
+#ifdef PHYSICS_DEBUG_LOGGING
+    // Runs once per wheel substep, so only every 60th call prints.
+    if (engineDebugCounter++ % 60 == 0) {
+        std::cout << "RPM: " << engine.getRPM() << " | WheelOmega: " << avgWheelOmega
+                << " | ClutchTorque: " << gearbox.getClutchTorque() << std::endl;
     }
 #endif
 
-    baseTorque *= inertiaCorrection;
-    baseTorque *= 1.25;
+    // Brake and tire torque the driven wheels will see this step, at their
+    // current spin.
+    double wheelLoadTorque = 0.0;
+    for (Wheel* wheel : rearWheels) {
+        Eigen::Vector2d wheelVelocityLocal = calculateWheelVelocityLocal(wheel->position);
+        Wheel::TireForce tire = wheel->evaluateFriction(wheelVelocityLocal, wheel->angular_velocity, tireResponseTime(dt));
+        wheelLoadTorque += wheel->angular_torque - tire.frictionTorque;
+    }
 
-    double reflectedWheelInertia = gearbox.getReflectedWheelInertia(PhysicsConstants::WHEEL_MOMENT_OF_INERTIA * 2.0);
-    double effectiveEngineInertia = (EngineConstants::ENGINE_MOMENT_OF_INERTIA + reflectedWheelInertia) * 0.12;
+    double totalWheelTorque = gearbox.convertEngineTorqueToWheel(
+        engine.getEngineTorque(), &engine, avgWheelOmega, params.tire.momentOfInertia * 2.0, wheelLoadTorque, dt);
+    // Open differential: the driven wheels split the clutch torque evenly.
+    double baseTorque = totalWheelTorque / 2.0;
 
     engine.addLoadTorque(gearbox.getClutchTorque());
-    engine.updateRPM(throttle, effectiveEngineInertia);
+    engine.updateRPM(throttle, params.engine.momentOfInertia, dt);
 
-    if (engine.getRPM() < 800.0 && getCurrentGear() != -1) {
+    if (engine.getRPM() < params.engine.stallRpm && getCurrentGear() != -1) {
         bool wasClutchHeld = gearbox.isClutchHeld();
         if (!wasClutchHeld) {
             gearbox.holdClutch();
@@ -191,7 +192,7 @@ void Car::updateEngine(double throttle) {
     }
 
     for (Wheel* wheel : rearWheels) {
-        if (wheel->angular_velocity * wheel->wheelRadius >= PhysicsConstants::CAR_TOP_SPEED)
+        if (wheel->angular_velocity * wheel->wheelRadius >= params.topSpeed)
         {
             wheel->tcsInterference = 0.0;
         }
@@ -199,12 +200,12 @@ void Car::updateEngine(double throttle) {
         double adjustedTorque = tcs.regulateTorque(
             *wheel,
             baseTorque,
-            PhysicsConstants::TIRE_SLIP_SETPOINT,
+            params.controllers.tcsSlipSetpoint,
             wheelVelocityLocal,
-            PhysicsConstants::TIME_INTERVAL
+            dt
         );
 
-        if (engine.getRPM() >= 8000.0 && adjustedTorque > 0.0) {
+        if (engine.getRPM() >= params.engine.maxRpm && adjustedTorque > 0.0) {
             adjustedTorque = 0.0;
         }
 
@@ -214,19 +215,23 @@ void Car::updateEngine(double throttle) {
 }
 
 void Car::applyBrakes() {
+    applyBrakes(timeStep);
+}
+
+void Car::applyBrakes(double dt) {
     for (Wheel* wheel : wheels) {
         Eigen::Vector2d wheelVelocityLocal = calculateWheelVelocityLocal(wheel->position);
-        Eigen::Vector2d wheelForward{sin(wheel->wheelAngle), cos(wheel->wheelAngle)};
+        Eigen::Vector2d wheelForward{PhysicsMath::sin(wheel->wheelAngle), PhysicsMath::cos(wheel->wheelAngle)};
         double vehicleSpeed = std::abs(wheelVelocityLocal.dot(wheelForward));
 
         double requestedBrakeTorque = braking_power * actualBrake * wheel->wheelRadius;
         double adjustedBrakeTorque = abs.regulateBrakePressure(
             *wheel,
             requestedBrakeTorque,
-            PhysicsConstants::ABS_SLIP_SETPOINT,
+            params.controllers.absSlipSetpoint,
             wheelVelocityLocal,
             vehicleSpeed,
-            PhysicsConstants::TIME_INTERVAL
+            dt
         );
 
         wheel->addTorque(adjustedBrakeTorque);
@@ -265,7 +270,7 @@ void Car::updateInputs(double timeInterval) {
     actualSteering += steeringChange;
     actualSteering = std::clamp(actualSteering, -1.0, 1.0);
 
-    double targetSteeringAngle = actualSteering * PhysicsConstants::MAX_STEERING_ANGLE;
+    double targetSteeringAngle = actualSteering * params.maxSteeringAngle;
     double speed = velocity.norm();
     double maxSpeed = 50.0;
     double speedFactor = 1.0 - (speed / maxSpeed) * 0.5;
@@ -274,48 +279,212 @@ void Car::updateInputs(double timeInterval) {
 
     steering_angle = targetSteeringAngle;
 
-    double wheelbase = RenderingConstants::WHEELBASE;
-    double trackWidth = RenderingConstants::TRACK_WIDTH;
-    double steeringRack = PhysicsConstants::STEERING_RACK;
-    double baseAngle = steering_angle * steeringRack;
+    steerFrontWheels();
+}
 
-    if (std::abs(baseAngle) < 0.001) {
-        frontLeft->wheelAngle = 0.0;
-        frontRight->wheelAngle = 0.0;
+void Car::applyInput(const VehicleInput& input) {
+    for (int i = 0; i < input.shiftUps; i++) {
+        shiftUp();
+    }
+    for (int i = 0; i < input.shiftDowns; i++) {
+        shiftDown();
+    }
+
+    setThrottle(input.throttle);
+    setBrake(input.brake);
+    setSteering(input.steering);
+
+    if (input.clutchHeld) {
+        holdClutch();
     } else {
-        double turnRadius = wheelbase / tan(std::abs(baseAngle));
-        double innerRadius = turnRadius - trackWidth / 2.0;
-        double outerRadius = turnRadius + trackWidth / 2.0;
-
-        double innerAngle = atan(wheelbase / innerRadius);
-        double outerAngle = atan(wheelbase / outerRadius);
-
-        if (baseAngle > 0) {
-            frontLeft->wheelAngle = innerAngle;
-            frontRight->wheelAngle = outerAngle;
-        } else {
-            frontLeft->wheelAngle = -outerAngle;
-            frontRight->wheelAngle = -innerAngle;
+        releaseClutch();
+    }
+}
+
+void Car::computeForces() {
+    updateInputs(timeStep);
+    // Load transfer once per step, before the clutch solve and the tire
+    // forces, which both read this step's wheel load.
+    updateLoadTransfer();
+    if (wheelSubsteps > 1) {
+        double dt = timeStep / wheelSubsteps;
+        for (int i = 0; i < wheelSubsteps; i++) {
+            spinWheels(dt);
         }
+        applyTireImpulse(timeStep);
+    } else {
+        applyBrakes();
+        updateEngine(targetThrottle);
+        sumWheelForces();
     }
+    updateAcceleration();
 }
 
-void Car::sumWheelForces() {
+void Car::integrate() {
+    integrateChassis<ChassisIntegrator>(timeStep);
+    if (wheelSubsteps > 1) {
+        applyForceFeedback();
+    } else {
+        moveWheels();
+    }
+}
+
+template <typename Integrator>
+void Car::integrateChassis(double time_interval) {
+    // Forces other than tire friction are held over the step.
+    Eigen::Vector3d otherLoad = Eigen::Vector3d::Zero();
+    if constexpr (Integrator::EVALUATIONS > 1) {
+        Eigen::Vector3d chassisVelocity(velocity.x(), velocity.y(), angular_velocity);
+        otherLoad = Eigen::Vector3d(forces.x(), forces.y(), angular_torque) -
+                    evaluateTireLoad(angular_position, chassisVelocity);
+    }
+
+    double startAngle = angular_position;
+    RigidBody::integrate<Integrator>(time_interval, [&](const Eigen::Vector3d& displacement, const Eigen::Vector3d& chassisVelocity) {
+        Eigen::Vector3d load = otherLoad + evaluateTireLoad(startAngle + displacement.z(), chassisVelocity);
+        return Eigen::Vector3d(load.x() / mass, load.y() / mass, load.z() / moment_of_inertia);
+    });
+}
+
+template void Car::integrateChassis<Integrators::ConstantAcceleration>(double);
+template void Car::integrateChassis<Integrators::SemiImplicitEuler>(double);
+template void Car::integrateChassis<Integrators::VelocityVerlet>(double);
+template void Car::integrateChassis<Integrators::RungeKutta4>(double);
+
+Eigen::Vector3d Car::evaluateTireLoad(double angle, const Eigen::Vector3d& chassisVelocity) const {
+    double cos_angle = PhysicsMath::cos(angle);
+    double sin_angle = PhysicsMath::sin(angle);
+
+    std::array<Eigen::Vector2d, 4> velocityLocal;
+    for (size_t i = 0; i < velocityLocal.size(); i++) {
+        velocityLocal[i] = wheelVelocityLocal(wheels[i]->position, angle, chassisVelocity);
+    }
+    TireModel<double>::LaneForces<4> tires = evaluateTires(velocityLocal, timeStep);
+
+    Eigen::Vector3d load = Eigen::Vector3d::Zero();
+    for (size_t i = 0; i < wheels.size(); i++) {
+        const Wheel* wheel = wheels[i];
+        Eigen::Vector2d forceLocal(tires.x[i], tires.y[i]);
+
+        load.x() += forceLocal.x() * cos_angle + forceLocal.y() * sin_angle;
+        load.y() += -forceLocal.x() * sin_angle + forceLocal.y() * cos_angle;
+        load.z() += wheel->position.x() * forceLocal.y() - wheel->position.y() * forceLocal.x();
+    }
+    return load;
+}
+
+void Car::step(const VehicleInput& input) {
+    applyInput(input);
+    if (multiRate) {
+        stepSubsystems();
+    } else {
+        computeForces();
+        integrate();
+    }
+}
+
+void Car::setSubsystemRates(double wheelRate, double chassisRate) {
+    subsystems = MultiRateScheduler();
+    subsystems.addTask(wheelRate, [this](double dt) { stepWheels(dt); });
+    subsystems.addTask(chassisRate, [this](double dt) { stepChassis(dt); });
+    chassisPeriod = 1.0 / chassisRate;
+    multiRate = true;
+}
+
+double Car::tireResponseTime(double dt) const {
+    // The tire forces close slip against the chassis, which only moves once
+    // per chassis step, so that is the response they are tuned for.
+    return multiRate ? std::max(dt, chassisPeriod) : timeStep;
+}
+
+void Car::stepSubsystems() {
+    subsystems.advance(timeStep);
+}
+
+void Car::stepWheels(double dt) {
+    updateInputs(dt);
+    spinWheels(dt);
+    chassisElapsed += dt;
+}
+
+void Car::spinWheels(double dt) {
+    applyBrakes(dt);
+    updateEngine(targetThrottle, dt);
+
+    double angle = contactAngle();
+    double cos_angle = PhysicsMath::cos(angle);
+    double sin_angle = PhysicsMath::sin(angle);
+
+    std::array<Eigen::Vector2d, 4> velocityLocal;
+    for (size_t i = 0; i < velocityLocal.size(); i++) {
+        velocityLocal[i] = calculateWheelVelocityLocal(wheels[i]->position);
+    }
+    TireModel<double>::LaneForces<4> tires = evaluateTires(velocityLocal, tireResponseTime(dt));
+
+    for (size_t i = 0; i < wheels.size(); i++) {
+        Wheel* wheel = wheels[i];
+        const Eigen::Vector2d& wheelVelocityLocal = velocityLocal[i];
+        Eigen::Vector2d wheelForceLocal = wheel->applyFriction(tires.at(i), wheelVelocityLocal, tireResponseTime(dt));
+
+        Eigen::Vector2d wheelForceWorld(
+            wheelForceLocal.x() * cos_angle + wheelForceLocal.y() * sin_angle,
+            -wheelForceLocal.x() * sin_angle + wheelForceLocal.y() * cos_angle
+        );
+        wheel->lastVelocity = Eigen::Vector2d(
+            wheelVelocityLocal.x() * cos_angle + wheelVelocityLocal.y() * sin_angle,
+            -wheelVelocityLocal.x() * sin_angle + wheelVelocityLocal.y() * cos_angle
+        );
+        wheel->lastForce = wheelForceWorld / wheel->mass;
+
+        tireImpulse[i] += wheelForceWorld * dt;
+        yawImpulse += (wheel->position.x() * wheelForceLocal.y() - wheel->position.y() * wheelForceLocal.x()) * dt;
+
+        wheel->incrementTime(dt);
+    }
+}
+
+void Car::stepChassis(double dt) {
+    applyTireImpulse(dt);
+    incrementTime(dt);
+    applyForceFeedback();
     updateLoadTransfer();
+}
 
-    double cos_angle = cos(angular_position);
-    double sin_angle = sin(angular_position);
+void Car::applyTireImpulse(double interval) {
+    const char* wheelNames[] = {"FL Friction", "FR Friction", "RL Friction", "RR Friction"};
+    for (size_t i = 0; i < wheels.size(); i++) {
+        addForce(tireImpulse[i] / interval, wheelNames[i]);
+    }
+    addTorque(yawImpulse / interval);
+    resetChassisInterval();
+}
+
+void Car::resetChassisInterval() {
+    tireImpulse.fill(Eigen::Vector2d::Zero());
+    yawImpulse = 0.0;
+    chassisElapsed = 0.0;
+}
+
+void Car::sumWheelForces() {
+    double cos_angle = PhysicsMath::cos(angular_position);
+    double sin_angle = PhysicsMath::sin(angular_position);
 
     Eigen::Vector2d totalForceLocal = Eigen::Vector2d::Zero();
     double totalTorque = 0.0;
 
     const char* wheelNames[] = {"FL Friction", "FR Friction", "RL Friction", "RR Friction"};
-    int wheelIndex = 0;
 
-    for (Wheel* wheel : wheels) {
-        Eigen::Vector2d wheelVelocityLocal = calculateWheelVelocityLocal(wheel->position);
+    std::array<Eigen::Vector2d, 4> velocityLocal;
+    for (size_t i = 0; i < velocityLocal.size(); i++) {
+        velocityLocal[i] = calculateWheelVelocityLocal(wheels[i]->position);
+    }
+    TireModel<double>::LaneForces<4> tires = evaluateTires(velocityLocal, timeStep);
+
+    for (size_t i = 0; i < wheels.size(); i++) {
+        Wheel* wheel = wheels[i];
+        const Eigen::Vector2d& wheelVelocityLocal = velocityLocal[i];
 
-        Eigen::Vector2d wheelForceLocal = wheel->calculateFriction(wheelVelocityLocal, PhysicsConstants::TIME_INTERVAL);
+        Eigen::Vector2d wheelForceLocal = wheel->applyFriction(tires.at(i), wheelVelocityLocal, timeStep);
 
         double torque = wheel->position.x() * wheelForceLocal.y() - wheel->position.y() * wheelForceLocal.x();
 
@@ -332,7 +501,7 @@ void Car::sumWheelForces() {
         wheel->lastVelocity = wheelVelocityWorld;
         wheel->lastForce = wheelForceWorld / wheel->mass;
 
-        addForce(wheelForceWorld, wheelNames[wheelIndex++]);
+        addForce(wheelForceWorld, wheelNames[i]);
 
         totalForceLocal += wheelForceLocal;
         totalTorque += torque;
@@ -340,9 +509,8 @@ void Car::sumWheelForces() {
 
     addTorque(totalTorque);
 
-#ifndef __EMSCRIPTEN__
-    static int debugCounter = 0;
-    if (std::abs(angular_velocity) > 0.1 && debugCounter++ % 15 == 0) {
+#ifdef PHYSICS_DEBUG_LOGGING
+    if (std::abs(angular_velocity) > 0.1 && forceDebugCounter++ % 15 == 0) {
         double cos_a = cos(angular_position);
         double sin_a = sin(angular_position);
         Eigen::Vector2d velocityLocal(
@@ -362,25 +530,25 @@ void Car::sumWheelForces() {
 
 void Car::moveWheels() {
     for (Wheel* wheel : wheels) {
-        wheel->incrementTime(PhysicsConstants::TIME_INTERVAL);
+        wheel->incrementTime(timeStep);
     }
     applyForceFeedback();
 }
 
 void Car::updateLoadTransfer() {
-    double cos_angle = cos(angular_position);
-    double sin_angle = sin(angular_position);
+    double cos_angle = PhysicsMath::cos(angular_position);
+    double sin_angle = PhysicsMath::sin(angular_position);
 
     double ax_local = acceleration.x() * cos_angle - acceleration.y() * sin_angle;
     double ay_local = acceleration.x() * sin_angle + acceleration.y() * cos_angle;
 
-    double wheelbase = RenderingConstants::WHEELBASE;
-    double track_width = RenderingConstants::TRACK_WIDTH;
-    double cg_height = PhysicsConstants::CG_HEIGHT;
-    double weight = PhysicsConstants::CAR_WEIGHT;
+    double wheelbase = params.wheelbase;
+    double track_width = params.trackWidth;
+    double cg_height = params.cgHeight;
+    double weight = mass * 9.81;
 
-    double frontWeightBias = 0.6;
-    double rearWeightBias = 0.4;
+    double frontWeightBias = params.frontWeightBias;
+    double rearWeightBias = 1.0 - frontWeightBias;
     double frontNominalLoad = (weight * frontWeightBias) / 2.0;
     double rearNominalLoad = (weight * rearWeightBias) / 2.0;
 
@@ -397,24 +565,29 @@ void Car::updateLoadTransfer() {
     }
 }
 
-void Car::drawCar(SDL_Renderer* renderer, const Camera* camera) {
-    SDL_Texture* tex = getRectangleTexture(renderer);
-    SDL_Rect rect{
-        getPositionX(camera, RenderingConstants::SDL_WINDOW_WIDTH),
-        getPositionY(camera, RenderingConstants::SDL_WINDOW_LENGTH),
-        getWidth(),
-        getHeight()
-    };
-
-    double angleDegrees = angular_position * PhysicsConstants::RAD_TO_DEG;
-
-    SDL_RenderCopyEx(renderer, tex, NULL, &rect, angleDegrees, NULL, SDL_FLIP_NONE);
+void Car::drawCar(RenderBatch& batch, const Camera* camera) {
+    float w = static_cast<float>(getWidth());
+    float h = static_cast<float>(getHeight());
+    float carCenterX = getPositionX(camera, RenderingConstants::SDL_WINDOW_WIDTH) + getWidth() / 2;
+    float carCenterY = getPositionY(camera, RenderingConstants::SDL_WINDOW_LENGTH) + getHeight() / 2;
 
     double cos_angle = cos(angular_position);
     double sin_angle = sin(angular_position);
 
-    int carCenterX = rect.x + rect.w / 2;
-    int carCenterY = rect.y + rect.h / 2;
+    // Body and front indicator are rotated about the car centre, matching the
+    // clockwise rotation SDL_RenderCopyEx used for the old body texture.
+    auto bodyQuad = [&](float top, float bottom, SDL_Color color) {
+        const float localX[4] = {-w / 2, w / 2, w / 2, -w / 2};
+        const float localY[4] = {top, top, bottom, bottom};
+        SDL_FPoint corners[4];
+        for (int i = 0; i < 4; i++) {
+            corners[i].x = carCenterX + static_cast<float>(localX[i] * cos_angle - localY[i] * sin_angle);
+            corners[i].y = carCenterY + static_cast<float>(localX[i] * sin_angle + localY[i] * cos_angle);
+        }
+        batch.addQuad(RenderBatch::BODIES, corners, color);
+    };
+    bodyQuad(-h / 2, h / 2, {180, 180, 180, renderAlpha});
+    bodyQuad(-h / 2, -h / 2 + h / 10, {220, 220, 220, renderAlpha});
 
     for (Wheel* wheel : wheels) {
         double worldX = pos_x + wheel->position.x() * cos_angle - wheel->position.y() * sin_angle;
@@ -426,94 +599,59 @@ void Car::drawCar(SDL_Renderer* renderer, const Camera* camera) {
         double wheelLocalPixelX = wheel->position.x() * 10;
         double wheelLocalPixelY = wheel->position.y() * 10;
 
-        int wheelScreenX = carCenterX + static_cast<int>(wheelLocalPixelX * cos_angle - wheelLocalPixelY * sin_angle);
-        int wheelScreenY = carCenterY + static_cast<int>(wheelLocalPixelX * sin_angle + wheelLocalPixelY * cos_angle);
-
-        int tireRadius = static_cast<int>(PhysicsConstants::WHEEL_RADIUS * 10);
-        SDL_Rect tireRect = {
-            wheelScreenX - tireRadius,
-            wheelScreenY - tireRadius,
-            tireRadius * 2,
-            tireRadius * 2
-        };
+        int wheelScreenX = static_cast<int>(carCenterX) + static_cast<int>(wheelLocalPixelX * cos_angle - wheelLocalPixelY * sin_angle);
+        int wheelScreenY = static_cast<int>(carCenterY) + static_cast<int>(wheelLocalPixelX * sin_angle + wheelLocalPixelY * cos_angle);
 
-        SDL_SetRenderDrawColor(renderer, 40, 40, 40, 255);
-        SDL_RenderFillRect(renderer, &tireRect);
+        int tireRadius = static_cast<int>(params.tire.radius * 10);
+        batch.addRect(RenderBatch::WHEELS, wheelScreenX - tireRadius, wheelScreenY - tireRadius,
+                      tireRadius * 2, tireRadius * 2, {40, 40, 40, renderAlpha});
     }
 
-    drawDebugVectors(renderer, camera);
+    drawDebugVectors(batch, camera);
 }
 
-void Car::drawDebugVectors(SDL_Renderer* renderer, const Camera* camera) {
+void Car::drawDebugVectors(RenderBatch& batch, const Camera* camera) {
     if (!showDebugVectors) return;
 
     int centerX = getPositionX(camera, RenderingConstants::SDL_WINDOW_WIDTH) + getWidth() / 2;
     int centerY = getPositionY(camera, RenderingConstants::SDL_WINDOW_LENGTH) + getHeight() / 2;
 
-    const double velocityScale = 5.0;
-    const double accelScale = 20.0;
+    auto drawArrow = [&](const Eigen::Vector2d& vector, double scale, SDL_Color color) {
+        int endX = centerX + static_cast<int>(vector.x() * scale);
+        int endY = centerY - static_cast<int>(vector.y() * scale);
+        batch.addLine(RenderBatch::DEBUG, centerX, centerY, endX, endY, color);
 
-    if (velocity.norm() > 0.01) {
-        int velEndX = centerX + static_cast<int>(velocity.x() * velocityScale);
-        int velEndY = centerY - static_cast<int>(velocity.y() * velocityScale);
-
-        SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-        SDL_RenderDrawLine(renderer, centerX, centerY, velEndX, velEndY);
+        double angle = std::atan2(-vector.y(), vector.x());
+        int arrow1X = endX - DEBUG_ARROW_SIZE * std::cos(angle - 0.5);
+        int arrow1Y = endY - DEBUG_ARROW_SIZE * std::sin(angle - 0.5);
+        int arrow2X = endX - DEBUG_ARROW_SIZE * std::cos(angle + 0.5);
+        int arrow2Y = endY - DEBUG_ARROW_SIZE * std::sin(angle + 0.5);
 
-        double angle = std::atan2(-velocity.y(), velocity.x());
-        int arrowSize = 8;
-        int arrow1X = velEndX - arrowSize * std::cos(angle - 0.5);
-        int arrow1Y = velEndY - arrowSize * std::sin(angle - 0.5);
-        int arrow2X = velEndX - arrowSize * std::cos(angle + 0.5);
-        int arrow2Y = velEndY - arrowSize * std::sin(angle + 0.5);
+        batch.addLine(RenderBatch::DEBUG, endX, endY, arrow1X, arrow1Y, color);
+        batch.addLine(RenderBatch::DEBUG, endX, endY, arrow2X, arrow2Y, color);
+    };
 
-        SDL_RenderDrawLine(renderer, velEndX, velEndY, arrow1X, arrow1Y);
-        SDL_RenderDrawLine(renderer, velEndX, velEndY, arrow2X, arrow2Y);
+    if (velocity.norm() > 0.01) {
+        drawArrow(velocity, DEBUG_VELOCITY_SCALE, {0, 255, 0, 255});
     }
 
     if (acceleration.norm() > 0.01) {
-        int accelEndX = centerX + static_cast<int>(acceleration.x() * accelScale);
-        int accelEndY = centerY - static_cast<int>(acceleration.y() * accelScale);
-
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-        SDL_RenderDrawLine(renderer, centerX, centerY, accelEndX, accelEndY);
-
-        double angle = std::atan2(-acceleration.y(), acceleration.x());
-        int arrowSize = 8;
-        int arrow1X = accelEndX - arrowSize * std::cos(angle - 0.5);
-        int arrow1Y = accelEndY - arrowSize * std::sin(angle - 0.5);
-        int arrow2X = accelEndX - arrowSize * std::cos(angle + 0.5);
-        int arrow2Y = accelEndY - arrowSize * std::sin(angle + 0.5);
-
-        SDL_RenderDrawLine(renderer, accelEndX, accelEndY, arrow1X, arrow1Y);
-        SDL_RenderDrawLine(renderer, accelEndX, accelEndY, arrow2X, arrow2Y);
+        drawArrow(acceleration, DEBUG_ACCEL_SCALE, {255, 0, 0, 255});
     }
 }
 
-SDL_Texture* Car::getRectangleTexture(SDL_Renderer* renderer) {
-    if (carTexture == nullptr) {
-        carTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-                                       SDL_TEXTUREACCESS_TARGET, width, height);
-        SDL_SetTextureBlendMode(carTexture, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderTarget(renderer, carTexture);
-
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-        SDL_RenderClear(renderer);
-
-        int w = static_cast<int>(width);
-        int h = static_cast<int>(height);
+WorldRect Car::getRenderBounds() const {
+    double centerX = pos_x + width / 2;
+    double centerY = pos_y + height / 2;
 
-        SDL_SetRenderDrawColor(renderer, 180, 180, 180, 255);
-        SDL_Rect body = {0, 0, w, h};
-        SDL_RenderFillRect(renderer, &body);
-
-        SDL_SetRenderDrawColor(renderer, 220, 220, 220, 255);
-        SDL_Rect frontIndicator = {0, 0, w, h/10};
-        SDL_RenderFillRect(renderer, &frontIndicator);
-
-        SDL_SetRenderTarget(renderer, NULL);
+    // Half diagonal covers the body at any rotation; debug arrows reach
+    // further when the car is fast or accelerating hard.
+    double radius = 0.5 * std::sqrt(width * width + height * height);
+    if (showDebugVectors) {
+        radius = std::max(radius, velocity.norm() * DEBUG_VELOCITY_SCALE + DEBUG_ARROW_SIZE);
+        radius = std::max(radius, acceleration.norm() * DEBUG_ACCEL_SCALE + DEBUG_ARROW_SIZE);
     }
-    return carTexture;
+    return {centerX - radius, centerY - radius, centerX + radius, centerY + radius};
 }
 
 void Car::eraseCar(SDL_Renderer* renderer) {
@@ -522,7 +660,7 @@ void Car::eraseCar(SDL_Renderer* renderer) {
 }
 
 double Car::getAngleToWheel(Wheel* wheel) {
-    return steering_angle * PhysicsConstants::STEERING_RACK;
+    return steering_angle * params.steeringRack;
 }
 
 void Car::shiftUp() {
@@ -556,3 +694,106 @@ const Engine& Car::getEngine() const {
 const Gearbox& Car::getGearbox() const {
     return gearbox;
 }
+
+TelemetryFrame Car::captureTelemetry(double time) const {
+    TelemetryFrame frame{};
+    frame.time = time;
+
+    frame.pos_x = pos_x;
+    frame.pos_y = pos_y;
+    frame.velocity_x = velocity.x();
+    frame.velocity_y = velocity.y();
+    frame.acceleration_x = acceleration.x();
+    frame.acceleration_y = acceleration.y();
+    frame.forces_x = forces.x();
+    frame.forces_y = forces.y();
+
+    frame.angular_position = angular_position;
+    frame.angular_velocity = angular_velocity;
+    frame.angular_acceleration = angular_acceleration;
+    frame.angular_torque = angular_torque;
+
+    frame.steering_angle = steering_angle;
+    frame.targetThrottle = targetThrottle;
+    frame.actualThrottle = actualThrottle;
+    frame.targetBrake = targetBrake;
+    frame.actualBrake = actualBrake;
+    frame.targetSteering = targetSteering;
+    frame.actualSteering = actualSteering;
+
+    for (size_t i = 0; i < wheels.size(); i++) {
+        const Wheel* wheel = wheels[i];
+        WheelTelemetry& out = frame.wheels[i];
+
+        out.pos_x = wheel->pos_x;
+        out.pos_y = wheel->pos_y;
+        out.wheelAngle = wheel->wheelAngle;
+        out.angular_position = wheel->angular_position;
+        out.angular_velocity = wheel->angular_velocity;
+        out.angular_acceleration = wheel->angular_acceleration;
+        out.normalForce = wheel->normalForce;
+        out.gripLevel = wheel->gripLevel;
+        out.previousSlipError = wheel->previousSlipError;
+        out.tcsInterference = wheel->tcsInterference;
+        out.previousAbsSlipError = wheel->previousAbsSlipError;
+        out.absInterference = wheel->absInterference;
+        out.lastForce_x = wheel->lastForce.x();
+        out.lastForce_y = wheel->lastForce.y();
+        out.lastVelocity_x = wheel->lastVelocity.x();
+        out.lastVelocity_y = wheel->lastVelocity.y();
+    }
+
+    frame.engine = engine.getState();
+    frame.gearbox = gearbox.getState();
+
+    return frame;
+}
+
+void Car::applyTelemetry(const TelemetryFrame& frame) {
+    pos_x = frame.pos_x;
+    pos_y = frame.pos_y;
+    velocity = Eigen::Vector2d(frame.velocity_x, frame.velocity_y);
+    acceleration = Eigen::Vector2d(frame.acceleration_x, frame.acceleration_y);
+    forces = Eigen::Vector2d(frame.forces_x, frame.forces_y);
+    namedForces.clear();
+
+    angular_position = frame.angular_position;
+    angular_velocity = frame.angular_velocity;
+    angular_acceleration = frame.angular_acceleration;
+    angular_torque = frame.angular_torque;
+
+    steering_angle = frame.steering_angle;
+    targetThrottle = frame.targetThrottle;
+    actualThrottle = frame.actualThrottle;
+    targetBrake = frame.targetBrake;
+    actualBrake = frame.actualBrake;
+    targetSteering = frame.targetSteering;
+    actualSteering = frame.actualSteering;
+
+    for (size_t i = 0; i < wheels.size(); i++) {
+        Wheel* wheel = wheels[i];
+        const WheelTelemetry& in = frame.wheels[i];
+
+        wheel->pos_x = in.pos_x;
+        wheel->pos_y = in.pos_y;
+        wheel->wheelAngle = in.wheelAngle;
+        wheel->angular_position = in.angular_position;
+        wheel->angular_velocity = in.angular_velocity;
+        wheel->angular_acceleration = in.angular_acceleration;
+        wheel->angular_torque = 0.0;
+        wheel->normalForce = in.normalForce;
+        wheel->gripLevel = in.gripLevel;
+        wheel->previousSlipError = in.previousSlipError;
+        wheel->tcsInterference = in.tcsInterference;
+        wheel->previousAbsSlipError = in.previousAbsSlipError;
+        wheel->absInterference = in.absInterference;
+        wheel->lastForce = Eigen::Vector2d(in.lastForce_x, in.lastForce_y);
+        wheel->lastVelocity = Eigen::Vector2d(in.lastVelocity_x, in.lastVelocity_y);
+    }
+
+    engine.setState(frame.engine);
+    gearbox.setState(frame.gearbox);
+
+    resetChassisInterval();
+    subsystems.reset();
+}
@@ -1,9 +1,11 @@
 #include "vehicle/Engine.h"
 
-#include "config/Constants.h"
 #include "config/EngineConstants.h"
-#include "config/PhysicsConstants.h"
-#include "config/RenderingConstants.h"
+
+#include <algorithm>
+#include <cmath>
+
+Engine::Engine(const EngineParams& params) : params(params) {}
 
 void Engine::addLoadTorque(double torque)
 {
@@ -25,7 +27,7 @@ double Engine::getVolumetricEfficiency()
 double Engine::getAirFlowRate(double throttle)
 {
     double airDensity = EngineConstants::INTAKE_MANIFOLD_PRESSURE / (EngineConstants::R_AIR * EngineConstants::AIR_TEMP);
-    double airMassPerCycle = getVolumetricEfficiency() * airDensity * EngineConstants::CYLINDER_VOLUME * throttle;
+    double airMassPerCycle = getVolumetricEfficiency() * airDensity * params.cylinderVolume * throttle;
     return airMassPerCycle * (rpm / 120.0);
 }
 
@@ -37,17 +39,19 @@ double Engine::getAirFuelRatio()
 double Engine::getPowerGenerated(double throttle)
 {
     double fuelMass = getAirFlowRate(throttle) / getAirFuelRatio();
-    double powerGenerated = fuelMass * EngineConstants::LATENT_HEAT * EngineConstants::ENGINE_EFFICIENCY;
+    double powerGenerated = fuelMass * EngineConstants::LATENT_HEAT * params.efficiency;
     return powerGenerated;
 }
 
-void Engine::updateRPM(double throttle, double effectiveInertia)
+void Engine::updateRPM(double throttle, double effectiveInertia, double dt)
 {
-    double frictionTorque = EngineConstants::ENGINE_FRICTION_COEFFICIENT * rpm;
-    double netTorque = engineTorque - loadTorque - frictionTorque;
-    rpm += (netTorque / effectiveInertia) * (30 / M_PI) * PhysicsConstants::TIME_INTERVAL;
+    double frictionDamping = params.frictionCoefficient * (30 / M_PI);
+    double netTorque = engineTorque - loadTorque;
+    double omega = rpm * (M_PI / 30);
+    omega = (omega + (netTorque / effectiveInertia) * dt) / (1.0 + dt * frictionDamping / effectiveInertia);
+    rpm = omega * (30 / M_PI);
 
-    rpm = std::clamp(rpm, 0.0, 8000.0);
+    rpm = std::clamp(rpm, 0.0, params.maxRpm);
 
     loadTorque = 0;
 }
@@ -116,8 +120,21 @@ double Engine::getPowerGeneratedValue(double throttle) const
 {
     double airFlowRate = getAirFlowRateValue();
     double fuelMass = airFlowRate / 14.7;
-    double powerGenerated = fuelMass * EngineConstants::LATENT_HEAT * EngineConstants::ENGINE_EFFICIENCY;
+    double powerGenerated = fuelMass * EngineConstants::LATENT_HEAT * params.efficiency;
     return powerGenerated;
 }
 
+Engine::State Engine::getState() const
+{
+    return {rpm, loadTorque, engineTorque, currentPower, currentVolumetricEfficiency, currentAirFlowRate};
+}
 
+void Engine::setState(const State& state)
+{
+    rpm = state.rpm;
+    loadTorque = state.loadTorque;
+    engineTorque = state.engineTorque;
+    currentPower = state.currentPower;
+    currentVolumetricEfficiency = state.currentVolumetricEfficiency;
+    currentAirFlowRate = state.currentAirFlowRate;
+}
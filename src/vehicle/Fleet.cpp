@@ -0,0 +1,148 @@
+#include "vehicle/Fleet.h"
+
+#include <algorithm>
+#include <cmath>
+
+template <typename Scalar>
+Fleet<Scalar>::Fleet(const VehicleParams& params)
+    : constants(),
+      steeringGeometry(params),
+      maxSteeringAngle(Scalar(params.maxSteeringAngle)),
+      kernels(&selectFleetKernels<Scalar>()) {
+    constants.tire = TireModel<Scalar>::fromParams(params.tire);
+    constants.mass = Scalar(params.mass);
+    constants.yawInertia = Scalar(params.yawMomentOfInertia);
+    constants.wheelbase = Scalar(params.wheelbase);
+    constants.trackWidth = Scalar(params.trackWidth);
+    constants.cgHeight = Scalar(params.cgHeight);
+    constants.frontWeightBias = Scalar(params.frontWeightBias);
+    // Clutch locked in first gear, split by the open differential.
+    constants.driveTorque = Scalar(0.5 * params.gearbox.clutchMaxTorque * params.gearbox.gearRatios[0] *
+                                   params.gearbox.finalDrive);
+    constants.brakeTorque = Scalar(params.brakingPower * params.tire.radius);
+    constants.topSpeed = Scalar(params.topSpeed);
+
+    double x = params.bodyWidth / 2.0 - params.wheelWidthInset;
+    double y = params.bodyLength / 2.0 - params.wheelLengthInset;
+    const double wheelX[WHEELS] = {-x, x, -x, x};
+    const double wheelY[WHEELS] = {y, y, -y, -y};
+    for (int w = 0; w < WHEELS; w++) {
+        constants.wheelX[w] = Scalar(wheelX[w]);
+        constants.wheelY[w] = Scalar(wheelY[w]);
+    }
+}
+
+template <typename Scalar>
+int Fleet<Scalar>::place(double x, double y, double angle) {
+    size_t car = count++;
+    if (car >= originX.size()) {
+        resize(originX.size() + FLEET_LANE_PADDING);
+    }
+
+    if (floatingOrigin) {
+        originX[car] = x;
+        originY[car] = y;
+    } else {
+        posX[car] = Scalar(x);
+        posY[car] = Scalar(y);
+    }
+    heading[car] = Scalar(angle);
+    return static_cast<int>(car);
+}
+
+template <typename Scalar>
+void Fleet<Scalar>::resize(size_t columns) {
+    originX.resize(columns, 0.0);
+    originY.resize(columns, 0.0);
+    for (Column* column : {&posX, &posY, &velX, &velY, &accelX, &accelY, &heading, &yawRate, &yawAccel,
+                           &throttle, &brake, &steering, &cosHeading, &sinHeading, &forceX, &forceY, &torque}) {
+        column->resize(columns, Scalar(0));
+    }
+    for (int w = 0; w < WHEELS; w++) {
+        omega[w].resize(columns, Scalar(0));
+        wheelAngle[w].resize(columns, Scalar(0));
+        normalForce[w].resize(columns, Scalar(0));
+    }
+}
+
+template <typename Scalar>
+void Fleet<Scalar>::setInput(int car, const Input& input) {
+    throttle[car] = std::clamp(input.throttle, Scalar(0), Scalar(1));
+    brake[car] = std::clamp(input.brake, Scalar(0), Scalar(1));
+    steering[car] = std::clamp(input.steering, -maxSteeringAngle, maxSteeringAngle);
+}
+
+template <typename Scalar>
+Eigen::Vector2d Fleet<Scalar>::getPosition(int car) const {
+    return {originX[car] + static_cast<double>(posX[car]), originY[car] + static_cast<double>(posY[car])};
+}
+
+template <typename Scalar>
+Eigen::Vector2d Fleet<Scalar>::getVelocity(int car) const {
+    return {static_cast<double>(velX[car]), static_cast<double>(velY[car])};
+}
+
+template <typename Scalar>
+FleetState<Scalar> Fleet<Scalar>::state() {
+    FleetState<Scalar> s = constants;
+    s.count = originX.size();
+    s.posX = posX.data();
+    s.posY = posY.data();
+    s.velX = velX.data();
+    s.velY = velY.data();
+    s.accelX = accelX.data();
+    s.accelY = accelY.data();
+    s.heading = heading.data();
+    s.yawRate = yawRate.data();
+    s.yawAccel = yawAccel.data();
+    s.throttle = throttle.data();
+    s.brake = brake.data();
+    s.cosHeading = cosHeading.data();
+    s.sinHeading = sinHeading.data();
+    s.forceX = forceX.data();
+    s.forceY = forceY.data();
+    s.torque = torque.data();
+    for (int w = 0; w < WHEELS; w++) {
+        s.omega[w] = omega[w].data();
+        s.wheelAngle[w] = wheelAngle[w].data();
+        s.normalForce[w] = normalForce[w].data();
+    }
+    return s;
+}
+
+template <typename Scalar>
+void Fleet<Scalar>::step(double dt) {
+    steer();
+    FleetState<Scalar> s = state();
+    kernels->transferLoad(s);
+    kernels->applyTires(s, Scalar(dt));
+    kernels->integrateChassis(s, Scalar(dt));
+    if (floatingOrigin) {
+        rebase();
+    }
+}
+
+template <typename Scalar>
+void Fleet<Scalar>::steer() {
+    for (size_t i = 0; i < count; i++) {
+        typename SteeringGeometry<Scalar>::WheelAngles angles = steeringGeometry.wheelAngles(steering[i]);
+        wheelAngle[0][i] = angles.left;
+        wheelAngle[1][i] = angles.right;
+    }
+}
+
+template <typename Scalar>
+void Fleet<Scalar>::rebase() {
+    const Scalar limit = Scalar(REBASE_DISTANCE);
+    for (size_t i = 0; i < count; i++) {
+        if (std::abs(posX[i]) > limit || std::abs(posY[i]) > limit) {
+            originX[i] += static_cast<double>(posX[i]);
+            originY[i] += static_cast<double>(posY[i]);
+            posX[i] = Scalar(0);
+            posY[i] = Scalar(0);
+        }
+    }
+}
+
+template class Fleet<float>;
+template class Fleet<double>;
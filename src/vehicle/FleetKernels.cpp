@@ -0,0 +1,162 @@
+#include "vehicle/FleetKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "core/FastMath.h"
+#include "vehicle/FleetKernelLanes.h"
+
+namespace {
+    // The reference the SIMD kernels are checked against: one car at a time,
+    // with the scalar TireModel::evaluate and PhysicsMath.
+    template <typename Scalar>
+    struct ScalarKernels {
+        static void transferLoad(FleetState<Scalar>& s) {
+            const Scalar weight = s.mass * Scalar(9.81);
+            const Scalar frontNominal = weight * s.frontWeightBias / Scalar(2);
+            const Scalar rearNominal = weight * (Scalar(1) - s.frontWeightBias) / Scalar(2);
+            const Scalar minLoad = Scalar(FLEET_MIN_NORMAL_FORCE);
+
+            for (size_t i = 0; i < s.count; i++) {
+                Scalar cosAngle = PhysicsMath::cos(s.heading[i]);
+                Scalar sinAngle = PhysicsMath::sin(s.heading[i]);
+                s.cosHeading[i] = cosAngle;
+                s.sinHeading[i] = sinAngle;
+
+                Scalar axLocal = s.accelX[i] * cosAngle - s.accelY[i] * sinAngle;
+                Scalar ayLocal = s.accelX[i] * sinAngle + s.accelY[i] * cosAngle;
+
+                Scalar longitudinal = -s.mass * ayLocal * s.cgHeight / s.wheelbase;
+                Scalar lateral = -s.mass * axLocal * s.cgHeight / s.trackWidth;
+
+                s.normalForce[0][i] = std::max(minLoad, frontNominal + longitudinal - lateral);
+                s.normalForce[1][i] = std::max(minLoad, frontNominal + longitudinal + lateral);
+                s.normalForce[2][i] = std::max(minLoad, rearNominal - longitudinal - lateral);
+                s.normalForce[3][i] = std::max(minLoad, rearNominal - longitudinal + lateral);
+            }
+        }
+
+        static void applyTires(FleetState<Scalar>& s, Scalar dt) {
+            std::fill(s.forceX, s.forceX + s.count, Scalar(0));
+            std::fill(s.forceY, s.forceY + s.count, Scalar(0));
+            std::fill(s.torque, s.torque + s.count, Scalar(0));
+
+            for (int w = 0; w < FleetState<Scalar>::WHEELS; w++) {
+                const bool driven = w >= 2;
+                const Scalar px = s.wheelX[w];
+                const Scalar py = s.wheelY[w];
+
+                for (size_t i = 0; i < s.count; i++) {
+                    Scalar cosAngle = s.cosHeading[i];
+                    Scalar sinAngle = s.sinHeading[i];
+                    Scalar vx = s.velX[i] * cosAngle - s.velY[i] * sinAngle - s.yawRate[i] * py;
+                    Scalar vy = s.velX[i] * sinAngle + s.velY[i] * cosAngle + s.yawRate[i] * px;
+
+                    Scalar spin = s.omega[w][i];
+                    typename TireModel<Scalar>::Force f =
+                        s.tire.evaluate(s.wheelAngle[w][i], vx, vy, spin, s.normalForce[w][i], dt);
+
+                    s.forceX[i] += f.x * cosAngle + f.y * sinAngle;
+                    s.forceY[i] += -f.x * sinAngle + f.y * cosAngle;
+                    s.torque[i] += px * f.y - py * f.x;
+
+                    Scalar wheelTorque = -f.frictionTorque;
+                    if (driven && spin * s.tire.radius < s.topSpeed) {
+                        wheelTorque += s.throttle[i] * s.driveTorque;
+                    }
+                    bool braking = s.brake[i] > Scalar(0);
+                    if (braking && std::abs(spin) >= Scalar(FLEET_BRAKE_STOP_OMEGA)) {
+                        wheelTorque -= std::copysign(s.brake[i] * s.brakeTorque, spin);
+                    }
+
+                    Scalar next = spin + wheelTorque / s.tire.momentOfInertia * dt;
+                    if (braking && (std::abs(spin) < Scalar(FLEET_BRAKE_STOP_OMEGA) || next * spin < Scalar(0))) {
+                        next = Scalar(0);
+                    }
+                    s.omega[w][i] = next;
+                }
+            }
+        }
+
+        static void integrateChassis(FleetState<Scalar>& s, Scalar dt) {
+            const Scalar twoPi = Scalar(2.0 * M_PI);
+            for (size_t i = 0; i < s.count; i++) {
+                s.accelX[i] = s.forceX[i] / s.mass;
+                s.accelY[i] = s.forceY[i] / s.mass;
+                s.yawAccel[i] = s.torque[i] / s.yawInertia;
+
+                s.posX[i] += s.velX[i] * dt + Scalar(0.5) * s.accelX[i] * dt * dt;
+                s.posY[i] += s.velY[i] * dt + Scalar(0.5) * s.accelY[i] * dt * dt;
+                s.heading[i] += s.yawRate[i] * dt + Scalar(0.5) * s.yawAccel[i] * dt * dt;
+                s.heading[i] = std::remainder(s.heading[i], twoPi);
+
+                s.velX[i] += s.accelX[i] * dt;
+                s.velY[i] += s.accelY[i] * dt;
+                s.yawRate[i] += s.yawAccel[i] * dt;
+            }
+        }
+    };
+
+    const FleetKernelSet SCALAR_KERNELS = {
+        {"scalar", &ScalarKernels<float>::transferLoad, &ScalarKernels<float>::applyTires,
+         &ScalarKernels<float>::integrateChassis},
+        {"scalar", &ScalarKernels<double>::transferLoad, &ScalarKernels<double>::applyTires,
+         &ScalarKernels<double>::integrateChassis},
+    };
+}
+
+template <typename Scalar>
+std::vector<const FleetKernels<Scalar>*> supportedFleetKernels() {
+    std::vector<const FleetKernels<Scalar>*> kernels{&SCALAR_KERNELS.get<Scalar>()};
+#ifdef CARPHYS_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        kernels.push_back(&FLEET_KERNELS_SSE42.get<Scalar>());
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        kernels.push_back(&FLEET_KERNELS_AVX2.get<Scalar>());
+    }
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma")) {
+        kernels.push_back(&FLEET_KERNELS_AVX512.get<Scalar>());
+    }
+#endif
+    return kernels;
+}
+
+template <typename Scalar>
+const FleetKernels<Scalar>* findFleetKernels(const char* name) {
+    for (const FleetKernels<Scalar>* kernels : supportedFleetKernels<Scalar>()) {
+        if (std::strcmp(kernels->name, name) == 0) {
+            return kernels;
+        }
+    }
+    return nullptr;
+}
+
+template <typename Scalar>
+const FleetKernels<Scalar>& selectFleetKernels() {
+    static const FleetKernels<Scalar>& selected = []() -> const FleetKernels<Scalar>& {
+        const FleetKernels<Scalar>* widest = supportedFleetKernels<Scalar>().back();
+        const char* forced = std::getenv("CARPHYS_SIMD");
+        if (forced == nullptr || *forced == '\0') {
+            return *widest;
+        }
+        if (const FleetKernels<Scalar>* kernels = findFleetKernels<Scalar>(forced)) {
+            return *kernels;
+        }
+        std::cerr << "CARPHYS_SIMD=" << forced << " is not available on this CPU, using "
+                  << widest->name << std::endl;
+        return *widest;
+    }();
+    return selected;
+}
+
+template std::vector<const FleetKernels<float>*> supportedFleetKernels<float>();
+template std::vector<const FleetKernels<double>*> supportedFleetKernels<double>();
+template const FleetKernels<float>* findFleetKernels<float>(const char*);
+template const FleetKernels<double>* findFleetKernels<double>(const char*);
+template const FleetKernels<float>& selectFleetKernels<float>();
+template const FleetKernels<double>& selectFleetKernels<double>();
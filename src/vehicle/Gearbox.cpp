@@ -2,6 +2,7 @@
 
 #include "config/PhysicsConstants.h"
 #include "vehicle/Engine.h"
+#include <algorithm>
 #include <iostream>
 
 Gearbox::Gearbox(const std::vector<double>& ratios, double finalDriveRatio)
@@ -18,6 +19,14 @@ Gearbox::Gearbox(const std::vector<double>& ratios, double finalDriveRatio)
     this->heldTorque = 0.0;
 }
 
+Gearbox::Gearbox(const GearboxParams& params)
+    : Gearbox(std::vector<double>(params.gearRatios, params.gearRatios + params.gearCount), params.finalDrive)
+{
+    this->clutchMaxTorque = params.clutchMaxTorque;
+    this->clutchSlipK = params.clutchSlipK;
+    this->clutchLockThreshold = params.clutchLockThreshold;
+}
+
 bool Gearbox::isClutchHeld() const
 {
     return clutchPressed;
@@ -96,7 +105,7 @@ bool Gearbox::shiftUp()
     return false;
 }
 
-double Gearbox::calculateBite()
+double Gearbox::calculateBite() const
 {
     double bite;
     if (clutchEngagement < 0.6)
@@ -108,11 +117,17 @@ double Gearbox::calculateBite()
 
     return bite;
 }
-double Gearbox::convertEngineTorqueToWheel(double engineTorque, Engine* engine, double wheelOmega)
+
+bool Gearbox::isClutchLocked() const
+{
+    return selectedGear != -1 && !clutchPressed && calculateBite() >= clutchLockThreshold;
+}
+
+double Gearbox::convertEngineTorqueToWheel(double engineTorque, Engine* engine, double wheelOmega,
+                                           double wheelInertia, double wheelLoadTorque, double dt)
 {
-#ifndef __EMSCRIPTEN__
-    static int callCounter = 0;
-    if (callCounter++ % 60 == 0) {
+#ifdef PHYSICS_DEBUG_LOGGING
+    if (callDebugCounter++ % 60 == 0) {
         std::cout << ">>> convertEngineTorqueToWheel CALLED | Gear: " << selectedGear
                   << " | ClutchPressed: " << clutchPressed << std::endl;
     }
@@ -139,9 +154,8 @@ double Gearbox::convertEngineTorqueToWheel(double engineTorque, Engine* engine,
     double transOmega = wheelOmega * wheelToEngineRatio();
     double slip = engineOmega - transOmega;
 
-#ifndef __EMSCRIPTEN__
-    static int debugCounter = 0;
-    if (debugCounter++ % 10 == 0) {
+#ifdef PHYSICS_DEBUG_LOGGING
+    if (clutchDebugCounter++ % 10 == 0) {
         std::cout << "\n=== CLUTCH DEBUG ===" << std::endl;
         std::cout << "EngineRPM: " << engine->getRPM() << " | EngineOmega: " << engineOmega << " rad/s" << std::endl;
         std::cout << "WheelOmega: " << wheelOmega << " rad/s | TransOmega: " << transOmega << " rad/s" << std::endl;
@@ -152,31 +166,33 @@ double Gearbox::convertEngineTorqueToWheel(double engineTorque, Engine* engine,
 #endif
 
     this->heldTorque = engineTorque;
-    double targetTorque;
+    convertWheelTorqueToEngine(wheelLoadTorque);
+
+    // Solve for the clutch torque against the state both sides reach at the
+    // end of the step: engine friction is taken implicitly and the driven
+    // wheels carry this step's brake and tire torque. The slip this leaves is
+    // slipFree - torque * dt * slipCompliance, which can't overshoot zero
+    // however large dt is.
+    const EngineParams& engineParams = engine->getParams();
+    double ratio = wheelToEngineRatio();
+    double frictionDamping = engineParams.frictionCoefficient * (30.0 / M_PI);
+    double engineDecay = 1.0 / (1.0 + dt * frictionDamping / engineParams.momentOfInertia);
 
-    if (bite >= PhysicsConstants::CLUTCH_LOCK_THRESHOLD) {
-        double lockingK = PhysicsConstants::CLUTCH_SLIP_K * 3.0;
-        double dampingK = lockingK * 0.5;
+    double engineOmegaFree = engineDecay * (engineOmega + dt * engineTorque / engineParams.momentOfInertia);
+    double wheelOmegaFree = wheelOmega + dt * wheelLoadTorque / wheelInertia;
+    double slipFree = engineOmegaFree - wheelOmegaFree * ratio;
+    double slipCompliance = engineDecay / engineParams.momentOfInertia + ratio * ratio / wheelInertia;
 
-        double slipRate = (slip - this->clutchSlip) / PhysicsConstants::TIME_INTERVAL;
-        slipRate = std::clamp(slipRate, -500.0, 500.0);
-        targetTorque = slip * lockingK + slipRate * dampingK;
-        targetTorque = std::clamp(targetTorque, -PhysicsConstants::CLUTCH_MAX_TORQUE, PhysicsConstants::CLUTCH_MAX_TORQUE);
-    } else {
-        double torqueMax = bite * PhysicsConstants::CLUTCH_MAX_TORQUE;
-        targetTorque = std::clamp(slip * PhysicsConstants::CLUTCH_SLIP_K, -torqueMax, torqueMax);
-    }
-
-    double smoothing = 0.12;
     double torqueClutch;
-
-    bool sameSign = (this->clutchTorque >= 0) == (targetTorque >= 0);
-    if (sameSign || std::abs(this->clutchTorque) < 1.0) {
-        torqueClutch = this->clutchTorque + smoothing * (targetTorque - this->clutchTorque);
+    if (bite >= clutchLockThreshold) {
+        torqueClutch = slipFree / (dt * slipCompliance);
     } else {
-        torqueClutch = this->clutchTorque * (1.0 - smoothing);
+        torqueClutch = clutchSlipK * slipFree / (1.0 + clutchSlipK * dt * slipCompliance);
     }
 
+    double torqueMax = bite * clutchMaxTorque;
+    torqueClutch = std::clamp(torqueClutch, -torqueMax, torqueMax);
+
     if (std::isnan(torqueClutch) || std::isinf(torqueClutch)) {
         torqueClutch = 0.0;
     }
@@ -185,18 +201,13 @@ double Gearbox::convertEngineTorqueToWheel(double engineTorque, Engine* engine,
     this->clutchTorque = torqueClutch;
     this->clutchSlip = slip;
 
-    double ratio = engineToWheelRatio();
-    double wheelTorque = (std::abs(ratio) > 1e-6) ? (torqueClutch / ratio) : 0.0;
+    double wheelTorque = torqueClutch * ratio;
 
-#ifndef __EMSCRIPTEN__
-    if (debugCounter % 10 == 1) {
+#ifdef PHYSICS_DEBUG_LOGGING
+    if (clutchDebugCounter % 10 == 1) {
         std::cout << "EngineInputTorque: " << engineTorque << " Nm" << std::endl;
         std::cout << "ClutchTorque: " << torqueClutch << " Nm | WheelTorque: " << wheelTorque << " Nm" << std::endl;
-        std::cout << "LockingMode: " << (bite >= PhysicsConstants::CLUTCH_LOCK_THRESHOLD ? "YES" : "NO");
-        if (bite >= PhysicsConstants::CLUTCH_LOCK_THRESHOLD) {
-            std::cout << " | lockingK=" << (PhysicsConstants::CLUTCH_SLIP_K * 120.0);
-        }
-        std::cout << std::endl;
+        std::cout << "LockingMode: " << (bite >= clutchLockThreshold ? "YES" : "NO") << std::endl;
         std::cout << "===================" << std::endl;
     }
 #endif
@@ -220,11 +231,11 @@ double Gearbox::getEngineTorque()
     return engineTorque;
 }
 
-void Gearbox::update()
+void Gearbox::update(double dt)
 {
     double target = clutchPressed ? 0.0 : 1.0;
     double rate = target > clutchEngagement ? 12.0 : 6.0;
-    clutchEngagement += (target - clutchEngagement) * rate * PhysicsConstants::TIME_INTERVAL;
+    clutchEngagement += (target - clutchEngagement) * rate * dt;
 }
 
 double Gearbox::getClutchEngagement() const
@@ -260,3 +271,20 @@ double Gearbox::getReflectedWheelInertia(double wheelInertia) const
     return wheelInertia / (ratio * ratio);
 }
 
+Gearbox::State Gearbox::getState() const
+{
+    return {selectedGear, clutchPressed ? 1 : 0, clutchEngagement, loadTorque,
+            engineTorque, clutchTorque, clutchSlip, heldTorque};
+}
+
+void Gearbox::setState(const State& state)
+{
+    selectedGear = state.selectedGear;
+    clutchPressed = state.clutchPressed != 0;
+    clutchEngagement = state.clutchEngagement;
+    loadTorque = state.loadTorque;
+    engineTorque = state.engineTorque;
+    clutchTorque = state.clutchTorque;
+    clutchSlip = state.clutchSlip;
+    heldTorque = state.heldTorque;
+}
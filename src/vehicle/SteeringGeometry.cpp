@@ -0,0 +1,35 @@
+#include "vehicle/SteeringGeometry.h"
+
+template <typename Scalar>
+SteeringGeometry<Scalar>::SteeringGeometry(const VehicleParams& params)
+    : steeringRack(Scalar(params.steeringRack)),
+      inverseSpacing(Scalar(INTERVALS / params.maxSteeringAngle)),
+      table(INTERVALS + 1) {
+    const double wheelbase = params.wheelbase;
+    const double halfTrack = params.trackWidth / 2.0;
+    const double spacing = params.maxSteeringAngle / INTERVALS;
+
+    // With T = tan(base angle), a wheel turned about a center offset from the
+    // car's by the given half track sits at atan2(wheelbase T, wheelbase -
+    // offset T), the same angle as Car's atan(wheelbase / (turnRadius -
+    // offset)) without the flip. Its slope follows from dT/dsteering =
+    // steeringRack (1 + T^2).
+    auto angle = [&](double tangent, double offset) {
+        return std::atan2(wheelbase * tangent, wheelbase - offset * tangent);
+    };
+    auto slope = [&](double tangent, double offset) {
+        double along = wheelbase - offset * tangent;
+        double across = wheelbase * tangent;
+        double dTangent = params.steeringRack * (1.0 + tangent * tangent);
+        return wheelbase * wheelbase / (across * across + along * along) * dTangent * spacing;
+    };
+
+    for (int i = 0; i <= INTERVALS; i++) {
+        double tangent = std::tan(i * spacing * params.steeringRack);
+        table[i] = {Scalar(angle(tangent, halfTrack)), Scalar(slope(tangent, halfTrack)),
+                    Scalar(angle(tangent, -halfTrack)), Scalar(slope(tangent, -halfTrack))};
+    }
+}
+
+template class SteeringGeometry<float>;
+template class SteeringGeometry<double>;
@@ -0,0 +1,74 @@
+#include "vehicle/VehicleCatalog.h"
+
+#include <cstdio>
+#include <cstring>
+
+VehicleCatalog::VehicleCatalog() : records(nullptr), count(0) {}
+
+bool VehicleCatalog::open(const std::string& path) {
+    close();
+
+    if (!file.open(path)) {
+        return false;
+    }
+
+    if (file.size() < sizeof(VehicleCatalogHeader)) {
+        close();
+        return false;
+    }
+
+    const VehicleCatalogHeader* header = reinterpret_cast<const VehicleCatalogHeader*>(file.data());
+    if (std::memcmp(header->magic, VehicleCatalogFormat::MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != VehicleCatalogFormat::VERSION ||
+        header->recordSize != sizeof(VehicleParams)) {
+        close();
+        return false;
+    }
+
+    size_t available = (file.size() - sizeof(VehicleCatalogHeader)) / sizeof(VehicleParams);
+    if (header->count > available) {
+        close();
+        return false;
+    }
+
+    records = reinterpret_cast<const VehicleParams*>(file.data() + sizeof(VehicleCatalogHeader));
+    count = static_cast<size_t>(header->count);
+    return true;
+}
+
+void VehicleCatalog::close() {
+    file.close();
+    records = nullptr;
+    count = 0;
+}
+
+const VehicleParams* VehicleCatalog::find(const std::string& name) const {
+    if (name.size() >= VehicleParams::NAME_LENGTH) return nullptr;
+
+    for (size_t i = 0; i < count; i++) {
+        if (std::strncmp(records[i].name, name.c_str(), VehicleParams::NAME_LENGTH) == 0) {
+            return &records[i];
+        }
+    }
+    return nullptr;
+}
+
+bool VehicleCatalog::write(const std::string& path, const std::vector<VehicleParams>& vehicles) {
+    FILE* out = std::fopen(path.c_str(), "wb");
+    if (out == nullptr) {
+        return false;
+    }
+
+    VehicleCatalogHeader header{};
+    std::memcpy(header.magic, VehicleCatalogFormat::MAGIC, sizeof(header.magic));
+    header.version = VehicleCatalogFormat::VERSION;
+    header.recordSize = sizeof(VehicleParams);
+    header.count = vehicles.size();
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, out) == 1;
+    if (ok && !vehicles.empty()) {
+        ok = std::fwrite(vehicles.data(), sizeof(VehicleParams), vehicles.size(), out) == vehicles.size();
+    }
+
+    return std::fclose(out) == 0 && ok;
+}
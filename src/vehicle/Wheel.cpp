@@ -1,12 +1,19 @@
 #include "vehicle/Wheel.h"
 
-Wheel::Wheel() : wheelAngle(0) {
-    mass = PhysicsConstants::WHEEL_MASS;
-    moment_of_inertia = PhysicsConstants::WHEEL_MOMENT_OF_INERTIA;
+#include "core/FastMath.h"
+
+Wheel::Wheel() : Wheel(TireParams()) {}
+
+Wheel::Wheel(const TireParams& tire)
+    : wheelAngle(0), wheelRadius(tire.radius), frictionCoefficient(tire.friction),
+      peakSlipAngle(tire.peakSlipAngle), slideRatio(tire.slideRatio),
+      lowSpeedThreshold(tire.lowSpeedThreshold) {
+    mass = tire.mass;
+    moment_of_inertia = tire.momentOfInertia;
 }
 
 double Wheel::calculateSlipRatio(Eigen::Vector2d wheelVelocityLocal) {
-    Eigen::Vector2d wheelForward{sin(wheelAngle), cos(wheelAngle)};
+    Eigen::Vector2d wheelForward{PhysicsMath::sin(wheelAngle), PhysicsMath::cos(wheelAngle)};
 
     double vehicleSpeed = wheelVelocityLocal.dot(wheelForward);
 
@@ -22,74 +29,50 @@ double Wheel::calculateSlipRatio(Eigen::Vector2d wheelVelocityLocal) {
     return slipRatio;
 }
 
-Eigen::Vector2d Wheel::calculateFriction(Eigen::Vector2d wheelVelocityLocal, double time_interval) {
-    Eigen::Vector2d wheelForward{sin(wheelAngle), cos(wheelAngle)};
-    Eigen::Vector2d wheelRight{cos(wheelAngle), -sin(wheelAngle)};
-
-    double velocityInWheelDir = wheelVelocityLocal.dot(wheelForward);
-    double wheelLinearVelocity = wheelRadius * angular_velocity;
-    double longitudinalSlip = wheelLinearVelocity - velocityInWheelDir;
+TireModel<double> Wheel::tireModel() const {
+    return {wheelRadius, moment_of_inertia, frictionCoefficient, peakSlipAngle, slideRatio, lowSpeedThreshold};
+}
 
-    double wheelMass = normalForce / 9.81;
+double Wheel::maxFrictionForce() const {
+    return tireModel().maxFrictionForce(normalForce);
+}
 
-    double nominalLoad = 2943.0;
-    double loadSensitivity = 0.9;
-    double loadFactor = std::pow(normalForce / nominalLoad, loadSensitivity);
-    double maxFrictionForce = nominalLoad * frictionCoefficient * loadFactor;
+double Wheel::longitudinalFriction(double longitudinalSlip, double maxForce, double time_interval) const {
+    return tireModel().longitudinalFriction(longitudinalSlip, normalForce, maxForce, time_interval);
+}
 
-    double longitudinalFriction = 0.0;
-    if (std::abs(longitudinalSlip) > 1e-5) {
-        const double LONGITUDINAL_FRICTION_RESPONSE = 0.6;
-        double requiredForce = (longitudinalSlip / time_interval) * wheelMass * LONGITUDINAL_FRICTION_RESPONSE;
-        longitudinalFriction = std::clamp(requiredForce, -maxFrictionForce, maxFrictionForce);
+double Wheel::frictionTorque(double longitudinalForce) const {
+    return tireModel().frictionTorque(longitudinalForce, normalForce);
+}
 
-        double wheelEffectiveMass = moment_of_inertia / (wheelRadius * wheelRadius);
-        double frictionTorque = longitudinalFriction * wheelRadius * (wheelEffectiveMass / wheelMass);
-        addTorque(-frictionTorque);
-    }
+Eigen::Vector2d Wheel::calculateFriction(Eigen::Vector2d wheelVelocityLocal, double time_interval) {
+    TireModel<double>::Force tire = tireModel().evaluate(wheelAngle, wheelVelocityLocal.x(), wheelVelocityLocal.y(),
+                                                         angular_velocity, normalForce, time_interval);
+    return applyFriction(tire, wheelVelocityLocal, time_interval);
+}
 
-    double lateralVelocity = wheelVelocityLocal.dot(wheelRight);
-    double lateralFriction = 0.0;
-
-    if (std::abs(lateralVelocity) > 1e-5) {
-        double speed = std::sqrt(velocityInWheelDir * velocityInWheelDir +
-                                 lateralVelocity * lateralVelocity);
-
-        if (speed < PhysicsConstants::TIRE_LOW_SPEED_THRESHOLD) {
-            const double LATERAL_FRICTION_RESPONSE = 0.45;
-            double requiredLateralForce = -(lateralVelocity / time_interval) * wheelMass * LATERAL_FRICTION_RESPONSE;
-            lateralFriction = std::clamp(requiredLateralForce, -maxFrictionForce, maxFrictionForce);
-        } else {
-            double slipAngle = std::atan2(std::abs(lateralVelocity), std::abs(velocityInWheelDir));
-
-            double normalizedAngle = slipAngle / PhysicsConstants::TIRE_PEAK_SLIP_ANGLE;
-            double forceMagnitude = 0.0;
-
-            if (normalizedAngle <= 1.0) {
-                forceMagnitude = maxFrictionForce * sin(normalizedAngle * M_PI / 2.0);
-            } else {
-                double excessAngle = slipAngle - PhysicsConstants::TIRE_PEAK_SLIP_ANGLE;
-                double decayRate = 8.0;
-                double slideRatio = PhysicsConstants::TIRE_SLIDE_RATIO;
-                forceMagnitude = maxFrictionForce * (slideRatio + (1.0 - slideRatio) * exp(-decayRate * excessAngle));
-            }
-
-            lateralFriction = -std::copysign(forceMagnitude, lateralVelocity);
-        }
+Eigen::Vector2d Wheel::applyFriction(const TireModel<double>::Force& tire, const Eigen::Vector2d& wheelVelocityLocal,
+                                     double time_interval) {
+    if (tire.frictionTorque != 0.0) {
+        addTorque(-tire.frictionTorque);
     }
+    gripLevel = tire.gripLevel;
 
-    double combinedMagnitude = std::sqrt(longitudinalFriction * longitudinalFriction +
-                                         lateralFriction * lateralFriction);
+    Eigen::Vector2d wheelForward{PhysicsMath::sin(wheelAngle), PhysicsMath::cos(wheelAngle)};
+    contact = {true, wheelVelocityLocal.dot(wheelForward), tire.maxFrictionForce, time_interval};
 
-    if (combinedMagnitude > maxFrictionForce) {
-        double scale = maxFrictionForce / combinedMagnitude;
-        longitudinalFriction *= scale;
-        lateralFriction *= scale;
-    }
+    return Eigen::Vector2d(tire.x, tire.y);
+}
 
-    gripLevel = (maxFrictionForce > 0.0) ? (combinedMagnitude / maxFrictionForce) : 0.0;
+Wheel::TireForce Wheel::evaluateFriction(const Eigen::Vector2d& wheelVelocityLocal, double omega, double time_interval) const {
+    TireModel<double>::Force tire = tireModel().evaluate(wheelAngle, wheelVelocityLocal.x(), wheelVelocityLocal.y(),
+                                                         omega, normalForce, time_interval);
 
-    return wheelForward * longitudinalFriction + wheelRight * lateralFriction;
+    TireForce result;
+    result.force = Eigen::Vector2d(tire.x, tire.y);
+    result.frictionTorque = tire.frictionTorque;
+    result.gripLevel = tire.gripLevel;
+    return result;
 }
 
 double Wheel::getLinearVelocity() {
@@ -101,9 +84,45 @@ void Wheel::setLinearVelocity(double linearVelocity) {
 }
 
 void Wheel::incrementTime(double time_interval) {
+    integrate<WheelIntegrator>(time_interval);
+}
+
+template <typename Integrator>
+void Wheel::integrate(double time_interval) {
     angular_acceleration = angular_torque / moment_of_inertia;
-    angular_position += angular_velocity * time_interval + 0.5 * angular_acceleration * time_interval * time_interval;
-    angular_velocity += angular_acceleration * time_interval;
 
+    // Torque from everything but the contact patch (drive, brakes) is held
+    // over the step; friction is re-evaluated at each stage's spin rate.
+    double externalTorque = angular_torque;
+    if constexpr (Integrator::EVALUATIONS > 1) {
+        if (contact.active) {
+            double slip = wheelRadius * angular_velocity - contact.forwardSpeed;
+            double force = longitudinalFriction(slip, contact.maxFrictionForce, contact.responseTime);
+            externalTorque += force != 0.0 ? frictionTorque(force) : 0.0;
+        }
+    }
+    auto accel = [&](double, double omega) {
+        double torque = externalTorque;
+        if (contact.active) {
+            double slip = wheelRadius * omega - contact.forwardSpeed;
+            double force = longitudinalFriction(slip, contact.maxFrictionForce, contact.responseTime);
+            torque -= force != 0.0 ? frictionTorque(force) : 0.0;
+        }
+        return torque / moment_of_inertia;
+    };
+
+    double rotation = 0.0;
+    double omega = angular_velocity;
+    Integrator::step(rotation, omega, angular_acceleration, accel, time_interval);
+
+    angular_position += rotation;
+    angular_velocity = omega;
+
+    contact.active = false;
     clearTorques();
 }
+
+template void Wheel::integrate<Integrators::ConstantAcceleration>(double);
+template void Wheel::integrate<Integrators::SemiImplicitEuler>(double);
+template void Wheel::integrate<Integrators::VelocityVerlet>(double);
+template void Wheel::integrate<Integrators::RungeKutta4>(double);
@@ -0,0 +1,11 @@
+// Fleet kernels for avx2, built with -mavx2 -mfma.
+#include "vehicle/FleetKernelLanes.h"
+
+namespace {
+    struct Avx2 {};
+}
+
+const FleetKernelSet FLEET_KERNELS_AVX2 = {
+    FleetKernelLanes<Avx2, float, 8>::kernels("avx2"),
+    FleetKernelLanes<Avx2, double, 4>::kernels("avx2"),
+};
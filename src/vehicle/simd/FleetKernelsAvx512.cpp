@@ -0,0 +1,11 @@
+// Fleet kernels for avx512, built with -mavx512f -mfma.
+#include "vehicle/FleetKernelLanes.h"
+
+namespace {
+    struct Avx512 {};
+}
+
+const FleetKernelSet FLEET_KERNELS_AVX512 = {
+    FleetKernelLanes<Avx512, float, 16>::kernels("avx512"),
+    FleetKernelLanes<Avx512, double, 8>::kernels("avx512"),
+};
@@ -0,0 +1,11 @@
+// Fleet kernels for sse4.2, built with -msse4.2.
+#include "vehicle/FleetKernelLanes.h"
+
+namespace {
+    struct Sse42 {};
+}
+
+const FleetKernelSet FLEET_KERNELS_SSE42 = {
+    FleetKernelLanes<Sse42, float, 4>::kernels("sse4.2"),
+    FleetKernelLanes<Sse42, double, 2>::kernels("sse4.2"),
+};
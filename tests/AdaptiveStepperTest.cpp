@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "vehicle/AdaptiveStepper.h"
+#include "vehicle/Car.h"
+#include "config/PhysicsConstants.h"
+#include "DrivingScenarios.h"
+#include <cmath>
+
+namespace {
+    using DrivingScenarios::engageFirstGear;
+
+    // Steps with a fixed dt until the engine stalls into neutral. Returns the
+    // time of the stall, or -1.
+    double fixedStallTime(double dt, double launchSeconds, double brakeSeconds) {
+        Car car(0, 0, 25, 45);
+        engageFirstGear(car);
+        car.setTimeStep(dt);
+
+        VehicleInput input;
+        input.throttle = 0.5f;
+        DrivingScenarios::hold(car, input, launchSeconds);
+
+        input = VehicleInput();
+        input.brake = 1.0f;
+        int brakeSteps = static_cast<int>(std::lround(brakeSeconds / dt));
+        for (int i = 0; i < brakeSteps; i++) {
+            car.step(input);
+            if (car.getCurrentGear() == -1) {
+                return launchSeconds + (i + 1) * dt;
+            }
+        }
+        return -1.0;
+    }
+}
+
+TEST(AdaptiveStepperTest, CruiseTakesFarFewerStepsThanFixed) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    const double duration = 40.0;
+    VehicleInput cruise;
+    cruise.throttle = 0.25f;
+
+    Car reference(0, 0, 25, 45);
+    engageFirstGear(reference);
+    reference.setTimeStep(dt / 8.0);
+    DrivingScenarios::hold(reference, cruise, duration);
+
+    Car car(0, 0, 25, 45);
+    engageFirstGear(car);
+    AdaptiveStepper stepper(car);
+    stepper.advance(cruise, duration);
+
+    EXPECT_NEAR(stepper.getTime(), duration, 1e-9);
+    EXPECT_LT(stepper.getAcceptedSteps(), duration / dt / 4.0);
+    EXPECT_LT(stepper.getEvaluations(), duration / dt);
+    EXPECT_NEAR(car.velocity.norm(), reference.velocity.norm(), 0.01 * reference.velocity.norm());
+    EXPECT_NEAR(car.pos_y, reference.pos_y, 0.01 * std::abs(reference.pos_y));
+}
+
+TEST(AdaptiveStepperTest, StallIsLocalizedWithinEventTolerance) {
+    const double launchSeconds = 1.0;
+    const double brakeSeconds = 3.0;
+    double referenceStall = fixedStallTime(PhysicsConstants::TIME_INTERVAL / 256.0, launchSeconds, brakeSeconds);
+    double fixedStall = fixedStallTime(PhysicsConstants::TIME_INTERVAL, launchSeconds, brakeSeconds);
+    ASSERT_GT(referenceStall, launchSeconds);
+
+    Car car(0, 0, 25, 45);
+    engageFirstGear(car);
+    AdaptiveStepSettings settings;
+    AdaptiveStepper stepper(car, settings);
+
+    VehicleInput input;
+    input.throttle = 0.5f;
+    stepper.advance(input, launchSeconds);
+    input = VehicleInput();
+    input.brake = 1.0f;
+    stepper.advance(input, brakeSeconds);
+
+    ASSERT_EQ(car.getCurrentGear(), -1);
+    // The bisected event steps don't leak into the car's own step.
+    EXPECT_EQ(car.getTimeStep(), PhysicsConstants::TIME_INTERVAL);
+    double stall = -1.0;
+    for (const AdaptiveStepper::Event& event : stepper.getEvents()) {
+        if (event.kind == AdaptiveStepper::GEAR_CHANGE) {
+            stall = event.time;
+        }
+    }
+    EXPECT_NEAR(stall, referenceStall, 2.0 * settings.eventTolerance);
+    EXPECT_LT(std::abs(stall - referenceStall), std::abs(fixedStall - referenceStall));
+}
@@ -0,0 +1,26 @@
+# Fails if the SIMD fleet kernel archive defines any global or weak code
+# symbol. Its kernels have internal linkage and everything they call is
+# inlined, so only the FLEET_KERNELS_* tables (data) should be visible.
+#
+#   cmake -DNM=<nm> -DARCHIVE=<libFleetSimdKernels.a> -P CheckFleetSimdSymbols.cmake
+
+execute_process(
+  COMMAND ${NM} --defined-only ${ARCHIVE}
+  OUTPUT_VARIABLE symbols
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${NM} failed on ${ARCHIVE}")
+endif()
+
+# T: global code, W: weak code, i: indirect (ifunc) code.
+string(REGEX MATCHALL "[^\n]* [TWi] [^\n]*" leaked "${symbols}")
+if(leaked)
+  string(REPLACE ";" "\n" leaked "${leaked}")
+  message(FATAL_ERROR "SIMD fleet kernels export code symbols:\n${leaked}")
+endif()
+
+string(REGEX MATCHALL "FLEET_KERNELS_[A-Z0-9]+" tables "${symbols}")
+if(NOT tables)
+  message(FATAL_ERROR "No FLEET_KERNELS_* tables in ${ARCHIVE}")
+endif()
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include "vehicle/Car.h"
+#include "core/TripleBuffer.h"
+#include "telemetry/RewindBuffer.h"
+#include "telemetry/SimulationThread.h"
+#include "telemetry/TelemetryRecorder.h"
+#include "telemetry/TelemetryReplay.h"
+#include "config/PhysicsConstants.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class ConcurrencyTest : public ::testing::Test {
+protected:
+    static constexpr int CAR_COUNT = 256;
+    static constexpr int STEP_COUNT = 300;
+
+    static VehicleInput inputFor(int carIndex, int step) {
+        VehicleInput input;
+        int phase = step + carIndex * 7;
+        input.throttle = (phase % 120) < 80 ? 1.0f : 0.2f;
+        input.brake = (phase % 120) >= 105 ? 0.8f : 0.0f;
+        input.steering = static_cast<float>((carIndex % 9) - 4) * 0.1f * ((step / 50) % 2 == 0 ? 1.0f : -1.0f);
+        input.clutchHeld = step < 5 ? 1 : 0;
+        input.shiftUps = (step == 2 || (carIndex % 3 == 0 && step == 150)) ? 1 : 0;
+        return input;
+    }
+
+    static std::vector<std::unique_ptr<Car>> makeFleet() {
+        std::vector<std::unique_ptr<Car>> cars;
+        for (int i = 0; i < CAR_COUNT; i++) {
+            cars.push_back(std::make_unique<Car>(100.0 + i * 10.0, 100.0, 25, 45));
+        }
+        return cars;
+    }
+
+    static void driveRange(std::vector<std::unique_ptr<Car>>& cars, int begin, int end) {
+        for (int step = 0; step < STEP_COUNT; step++) {
+            for (int i = begin; i < end; i++) {
+                cars[i]->step(inputFor(i, step));
+            }
+        }
+    }
+};
+
+TEST_F(ConcurrencyTest, ParallelSteppingMatchesSerial) {
+    auto serial = makeFleet();
+    driveRange(serial, 0, CAR_COUNT);
+
+    auto parallel = makeFleet();
+    int threadCount = static_cast<int>(std::max(8u, std::thread::hardware_concurrency()));
+    int perThread = (CAR_COUNT + threadCount - 1) / threadCount;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        int begin = std::min(CAR_COUNT, t * perThread);
+        int end = std::min(CAR_COUNT, begin + perThread);
+        threads.emplace_back(driveRange, std::ref(parallel), begin, end);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < CAR_COUNT; i++) {
+        TelemetryFrame expected = serial[i]->captureTelemetry(0.0);
+        TelemetryFrame actual = parallel[i]->captureTelemetry(0.0);
+
+        EXPECT_EQ(actual.pos_x, expected.pos_x) << "car " << i;
+        EXPECT_EQ(actual.pos_y, expected.pos_y) << "car " << i;
+        EXPECT_EQ(actual.velocity_x, expected.velocity_x) << "car " << i;
+        EXPECT_EQ(actual.velocity_y, expected.velocity_y) << "car " << i;
+        EXPECT_EQ(actual.angular_position, expected.angular_position) << "car " << i;
+        EXPECT_EQ(actual.engine.rpm, expected.engine.rpm) << "car " << i;
+        EXPECT_EQ(actual.gearbox.selectedGear, expected.gearbox.selectedGear) << "car " << i;
+        for (int w = 0; w < 4; w++) {
+            EXPECT_EQ(actual.wheels[w].angular_velocity, expected.wheels[w].angular_velocity) << "car " << i;
+        }
+    }
+}
+
+TEST_F(ConcurrencyTest, CarsOnSeparateThreadsDoNotInterfere) {
+    auto cars = makeFleet();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < CAR_COUNT; i++) {
+        threads.emplace_back(driveRange, std::ref(cars), i, i + 1);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    auto reference = makeFleet();
+    driveRange(reference, 0, 1);
+    TelemetryFrame expected = reference[0]->captureTelemetry(0.0);
+    TelemetryFrame actual = cars[0]->captureTelemetry(0.0);
+    EXPECT_EQ(actual.pos_y, expected.pos_y);
+    EXPECT_EQ(actual.engine.rpm, expected.engine.rpm);
+}
+
+TEST(TripleBufferTest, ReaderOnlySeesCompletePublishedValues) {
+    struct Sample {
+        long id;
+        long payload[16];
+    };
+    TripleBuffer<Sample> buffer;
+    const long lastId = 200000;
+
+    std::thread writer([&buffer, lastId]() {
+        for (long id = 1; id <= lastId; id++) {
+            Sample& sample = buffer.writeBuffer();
+            sample.id = id;
+            for (long& value : sample.payload) {
+                value = id * 3;
+            }
+            buffer.publish();
+        }
+    });
+
+    long lastSeen = 0;
+    while (lastSeen < lastId) {
+        if (!buffer.update()) continue;
+        const Sample& sample = buffer.read();
+        ASSERT_GT(sample.id, lastSeen);
+        for (long value : sample.payload) {
+            ASSERT_EQ(value, sample.id * 3);
+        }
+        lastSeen = sample.id;
+    }
+    writer.join();
+
+    EXPECT_FALSE(buffer.update());
+}
+
+TEST(SimulationThreadTest, ThreadedRunMatchesSerialStepping) {
+    Car car(100.0, 100.0, 25, 45);
+    RewindBuffer rewind;
+    TelemetryRecorder recorder;
+    SimulationThread simulation(car, rewind, recorder);
+
+    VehicleInput input;
+    input.throttle = 1.0f;
+    input.steering = 0.25f;
+    simulation.pushInput(InputEvent{0.0, InputEvent::THROTTLE, input.throttle});
+    simulation.pushInput(InputEvent{0.0, InputEvent::STEERING, input.steering});
+
+    simulation.start();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (simulation.getStepCount() < 20 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    simulation.stop();
+
+    long steps = simulation.getStepCount();
+    ASSERT_GE(steps, 20);
+    ASSERT_TRUE(simulation.pollSnapshot());
+    EXPECT_EQ(simulation.getSnapshot().step, steps);
+
+    Car reference(100.0, 100.0, 25, 45);
+    for (long i = 0; i < steps; i++) {
+        reference.step(input);
+    }
+    EXPECT_EQ(car.pos_x, reference.pos_x);
+    EXPECT_EQ(car.pos_y, reference.pos_y);
+    EXPECT_EQ(car.angular_position, reference.angular_position);
+    EXPECT_EQ(car.getEngine().getRPM(), reference.getEngine().getRPM());
+}
+
+TEST(SimulationThreadTest, InputEventsApplyAtTheStepTheyArriveBefore) {
+    Car car(100.0, 100.0, 25, 45);
+    RewindBuffer rewind;
+    TelemetryRecorder recorder;
+    SimulationThread simulation(car, rewind, recorder);
+
+    simulation.pushInput(InputEvent{1.000, InputEvent::THROTTLE, 1.0f});
+    simulation.pushInput(InputEvent{1.010, InputEvent::SHIFT_UP, 1.0f});
+    simulation.pushInput(InputEvent{1.020, InputEvent::THROTTLE, 0.5f});
+
+    simulation.step(0.990);
+    ASSERT_TRUE(simulation.pollSnapshot());
+    EXPECT_EQ(simulation.getSnapshot().frame.targetThrottle, 0.0);
+    EXPECT_EQ(simulation.getSnapshot().inputTime, 0.0);
+
+    simulation.step(1.015);
+    ASSERT_TRUE(simulation.pollSnapshot());
+    EXPECT_EQ(simulation.getSnapshot().frame.targetThrottle, 1.0);
+    EXPECT_EQ(simulation.getSnapshot().inputTime, 1.010);
+
+    simulation.step(1.030);
+    ASSERT_TRUE(simulation.pollSnapshot());
+    EXPECT_EQ(simulation.getSnapshot().frame.targetThrottle, 0.5);
+    EXPECT_EQ(simulation.getSnapshot().inputTime, 1.020);
+}
+
+TEST(SimulationThreadTest, MultiRateRecordingIsStampedWithTheStateItHolds) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    const std::string path = ::testing::TempDir() + "multi_rate_recording.bin";
+    Car car(100.0, 100.0, 25, 45);
+    car.setSubsystemRates(PhysicsConstants::WHEEL_RATE, PhysicsConstants::CHASSIS_RATE);
+    RewindBuffer rewind;
+    TelemetryRecorder recorder;
+    ASSERT_TRUE(recorder.open(path, dt));
+    SimulationThread simulation(car, rewind, recorder);
+
+    simulation.pushInput(InputEvent{0.0, InputEvent::THROTTLE, 1.0f});
+    for (int i = 0; i < 3; i++) {
+        simulation.step(0.0);
+        ASSERT_TRUE(simulation.pollSnapshot());
+    }
+    recorder.close();
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+    ASSERT_EQ(replay.getFrameCount(), 3u);
+    const TelemetryFrame& last = replay.getFrame(2);
+    const TelemetryFrame& snapshot = simulation.getSnapshot().frame;
+    EXPECT_DOUBLE_EQ(last.time, 3 * dt);
+    EXPECT_DOUBLE_EQ(last.time, snapshot.time);
+    EXPECT_EQ(last.pos_x, snapshot.pos_x);
+    EXPECT_EQ(last.velocity_y, snapshot.velocity_y);
+    replay.close();
+    std::remove(path.c_str());
+}
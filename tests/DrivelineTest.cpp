@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "vehicle/Car.h"
+#include "vehicle/Engine.h"
+#include "vehicle/Gearbox.h"
+#include "config/PhysicsConstants.h"
+#include "DrivingScenarios.h"
+#include <cmath>
+
+namespace {
+    // Full-throttle launch in first gear. Returns the speed after `seconds`
+    // and counts how often the engine speed changes direction once locked.
+    double launch(double dt, double seconds, int& rpmReversals) {
+        Car car(0, 0, 25, 45);
+        car.setTimeStep(dt);
+        DrivingScenarios::engageFirstGear(car);
+
+        VehicleInput input;
+        input.throttle = 1.0f;
+        rpmReversals = 0;
+        double lastRpm = car.getEngine().getRPM();
+        double lastChange = 0.0;
+        DrivingScenarios::hold(car, input, seconds, [&](long i) {
+            double change = car.getEngine().getRPM() - lastRpm;
+            if (i * dt > 0.5 && change * lastChange < 0.0 && std::abs(change) > 0.5) {
+                rpmReversals++;
+            }
+            lastChange = change;
+            lastRpm = car.getEngine().getRPM();
+        });
+        return car.velocity.norm();
+    }
+}
+
+TEST(DrivelineTest, LockedClutchMatchesEngineAndWheelsInOneStep) {
+    GearboxParams params;
+    Gearbox gearbox(params);
+    gearbox.holdClutch();
+    gearbox.shiftUp();
+    gearbox.releaseClutch();
+
+    const double wheelInertia = 2.0 * PhysicsConstants::WHEEL_MOMENT_OF_INERTIA;
+    const double ratio = gearbox.wheelToEngineRatio();
+
+    for (double dt : {0.016, 0.032, 0.064}) {
+        Engine engine;
+        engine.calculateTorque(0.3);
+        double engineOmega = engine.getRPM() * M_PI / 30.0;
+        // Wheels lag the engine, so the clutch has slip to take up.
+        double wheelOmega = 0.8 * engineOmega / ratio;
+
+        // Tire drag on the driven wheels.
+        const double wheelLoad = -40.0;
+        double wheelTorque = gearbox.convertEngineTorqueToWheel(engine.getEngineTorque(), &engine, wheelOmega,
+                                                               wheelInertia, wheelLoad, dt);
+        ASSERT_LT(std::abs(gearbox.getClutchTorque()), params.clutchMaxTorque);
+
+        engine.addLoadTorque(gearbox.getClutchTorque());
+        engine.updateRPM(0.3, engine.getParams().momentOfInertia, dt);
+        double wheelOmegaAfter = wheelOmega + (wheelTorque + wheelLoad) / wheelInertia * dt;
+
+        EXPECT_NEAR(engine.getRPM() * M_PI / 30.0, wheelOmegaAfter * ratio, 1e-9) << "dt " << dt;
+    }
+}
+
+TEST(DrivelineTest, LaunchStaysSmoothAtLargerTimeSteps) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    int reversals = 0;
+    double reference = launch(dt, 2.0, reversals);
+    EXPECT_LE(reversals, 2);
+    EXPECT_GT(reference, 5.0);
+
+    for (double scale : {2.0, 4.0}) {
+        double speed = launch(dt * scale, 2.0, reversals);
+        EXPECT_LE(reversals, 2) << "scale " << scale;
+        EXPECT_NEAR(speed, reference, 0.05 * reference) << "scale " << scale;
+    }
+}
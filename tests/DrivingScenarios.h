@@ -0,0 +1,59 @@
+#ifndef DRIVINGSCENARIOS_H
+#define DRIVINGSCENARIOS_H
+
+#include <cmath>
+
+#include "vehicle/Car.h"
+
+// Input scripts shared by the stepping tests. The caller sets up the car's
+// time step, wheel substeps or subsystem rates; the scripts step it with
+// car.step() at its own time step.
+namespace DrivingScenarios {
+    // Clutch in and shift into first, in two steps.
+    inline void engageFirstGear(Car& car) {
+        VehicleInput input;
+        input.clutchHeld = 1;
+        car.step(input);
+        input.shiftUps = 1;
+        car.step(input);
+    }
+
+    // Holds input for about `seconds`, calling after(step) after each step.
+    template <typename AfterStep>
+    void hold(Car& car, const VehicleInput& input, double seconds, AfterStep after) {
+        long steps = std::lround(seconds / car.getTimeStep());
+        for (long i = 0; i < steps; i++) {
+            car.step(input);
+            after(i);
+        }
+    }
+
+    inline void hold(Car& car, const VehicleInput& input, double seconds) {
+        hold(car, input, seconds, [](long) {});
+    }
+
+    struct Speeds {
+        double launchSpeed;
+        double brakeSpeed;
+    };
+
+    // Full-throttle launch in first gear, then braking at brake, each held
+    // for `seconds`.
+    inline Speeds launchAndBrake(Car& car, double seconds = 3.0, float brake = 0.8f) {
+        engageFirstGear(car);
+
+        Speeds speeds;
+        VehicleInput input;
+        input.throttle = 1.0f;
+        hold(car, input, seconds);
+        speeds.launchSpeed = car.velocity.norm();
+
+        input = VehicleInput();
+        input.brake = brake;
+        hold(car, input, seconds);
+        speeds.brakeSpeed = car.velocity.norm();
+        return speeds;
+    }
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "core/FastMath.h"
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+    using Lanes = Eigen::Array<double, 8, 1>;
+
+    // Largest error of fast against exact over [low, high]; relative where
+    // asked.
+    double maxError(const std::function<double(double)>& fast, const std::function<double(double)>& exact,
+                    double low, double high, bool relative = false) {
+        const int samples = 100000;
+        double worst = 0.0;
+        for (int i = 0; i <= samples; i++) {
+            double x = low + (high - low) * i / samples;
+            double error = std::abs(fast(x) - exact(x));
+            worst = std::max(worst, relative ? error / std::abs(exact(x)) : error);
+        }
+        return worst;
+    }
+}
+
+TEST(FastMathTest, StaysWithinDocumentedErrorOverSimulationRanges) {
+    // Headings, slip angles, the post-peak decay, load ratios and steering.
+    EXPECT_LT(maxError(FastMath::sin<double>, [](double x) { return std::sin(x); }, -M_PI, M_PI), 5e-8);
+    EXPECT_LT(maxError(FastMath::cos<double>, [](double x) { return std::cos(x); }, -M_PI, M_PI), 5e-8);
+    EXPECT_LT(maxError(FastMath::sin<double>, [](double x) { return std::sin(x); }, -1e4, 1e4), 5e-8);
+    EXPECT_LT(maxError(FastMath::atan<double>, [](double x) { return std::atan(x); }, -50.0, 50.0), 4e-8);
+    EXPECT_LT(maxError([](double y) { return FastMath::atan2(y, 3.0); }, [](double y) { return std::atan2(y, 3.0); },
+                       -30.0, 30.0), 4e-8);
+    EXPECT_LT(maxError([](double x) { return FastMath::atan2(3.0, x); }, [](double x) { return std::atan2(3.0, x); },
+                       -30.0, 30.0), 4e-8);
+    EXPECT_LT(maxError(FastMath::exp<double>, [](double x) { return std::exp(x); }, -12.5, 5.0, true), 8e-8);
+    EXPECT_LT(maxError(FastMath::log<double>, [](double x) { return std::log(x); }, 0.02, 3.1), 3e-8);
+    EXPECT_LT(maxError([](double x) { return FastMath::pow(x, 0.9); }, [](double x) { return std::pow(x, 0.9); },
+                       0.02, 3.1, true), 2e-7);
+    EXPECT_LT(maxError(FastMath::tan<double>, [](double x) { return std::tan(x); }, -1.4, 1.4, true), 2e-7);
+}
+
+TEST(FastMathTest, FloatAddsOnlyItsOwnRounding) {
+    auto asFloat = [](float (*f)(const float&)) { return [f](double x) { return double(f(float(x))); }; };
+    EXPECT_LT(maxError(asFloat(FastMath::sin<float>), [](double x) { return std::sin(double(float(x))); },
+                       -M_PI, M_PI), 5e-7);
+    EXPECT_LT(maxError(asFloat(FastMath::atan<float>), [](double x) { return std::atan(double(float(x))); },
+                       -50.0, 50.0), 5e-7);
+    EXPECT_LT(maxError(asFloat(FastMath::exp<float>), [](double x) { return std::exp(double(float(x))); },
+                       -12.5, 5.0, true), 5e-7);
+}
+
+TEST(FastMathTest, LanesMatchScalars) {
+    Lanes x;
+    x << -3.0, -1.2, -0.4, 0.0, 0.3, 0.9, 2.5, 40.0;
+    Lanes y = x.reverse();
+    Lanes sin = FastMath::sin(x);
+    Lanes cos = FastMath::cos(x);
+    Lanes atan = FastMath::atan(x);
+    Lanes atan2 = FastMath::atan2(y, x);
+    Lanes exp = FastMath::exp(x);
+    Lanes log = FastMath::log(x.abs() + 0.1);
+    for (int i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(sin[i], FastMath::sin(x[i]), 1e-15) << x[i];
+        EXPECT_NEAR(cos[i], FastMath::cos(x[i]), 1e-15) << x[i];
+        EXPECT_NEAR(atan[i], FastMath::atan(x[i]), 1e-15) << x[i];
+        EXPECT_NEAR(atan2[i], FastMath::atan2(y[i], x[i]), 1e-15) << y[i] << ", " << x[i];
+        EXPECT_DOUBLE_EQ(exp[i], FastMath::exp(x[i])) << x[i];
+        EXPECT_NEAR(log[i], FastMath::log(std::abs(x[i]) + 0.1), 1e-15) << x[i];
+    }
+}
+
+TEST(FastMathTest, ExactAtAxesAndLimits) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(FastMath::sin(0.0), 0.0);
+    EXPECT_EQ(FastMath::atan(0.0), 0.0);
+    EXPECT_DOUBLE_EQ(FastMath::atan(infinity), M_PI / 2.0);
+    EXPECT_DOUBLE_EQ(FastMath::atan(-infinity), -M_PI / 2.0);
+
+    EXPECT_EQ(FastMath::atan2(0.0, 0.0), 0.0);
+    EXPECT_EQ(FastMath::atan2(0.0, 2.0), 0.0);
+    EXPECT_DOUBLE_EQ(FastMath::atan2(0.0, -2.0), M_PI);
+    EXPECT_DOUBLE_EQ(FastMath::atan2(2.0, 0.0), M_PI / 2.0);
+    EXPECT_DOUBLE_EQ(FastMath::atan2(-2.0, 0.0), -M_PI / 2.0);
+
+    EXPECT_EQ(FastMath::log(1.0), 0.0);
+    EXPECT_NEAR(FastMath::exp(0.0), 1.0, 1e-7);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include "vehicle/Fleet.h"
+#include "vehicle/Car.h"
+#include "config/PhysicsConstants.h"
+#include "DrivingScenarios.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+    const int SCENARIOS = 3;
+    const double DURATION = 10.0;
+
+    struct Divergence {
+        double position;
+        double velocity;
+        double heading;
+    };
+
+    // Launch, then coast and brake to a stop: straight, in a steady turn and
+    // weaving. One car per scenario, all placed around (x, y).
+    template <typename Scalar>
+    void drive(Fleet<Scalar>& fleet, double x, double y) {
+        for (int s = 0; s < SCENARIOS; s++) {
+            fleet.place(x + 10.0 * s, y, 0.3);
+        }
+
+        const double dt = PhysicsConstants::TIME_INTERVAL;
+        for (int i = 0; i < std::lround(DURATION / dt); i++) {
+            double t = i * dt;
+            typename Fleet<Scalar>::Input input;
+            input.throttle = t < 4.0 ? Scalar(1) : Scalar(0);
+            input.brake = t > 6.0 ? Scalar(0.6) : Scalar(0);
+            for (int s = 0; s < SCENARIOS; s++) {
+                input.steering = Scalar(s == 1 ? 0.15 : s == 2 ? 0.3 * std::sin(t) : 0.0);
+                fleet.setInput(s, input);
+            }
+            fleet.step(dt);
+        }
+    }
+
+    template <typename A, typename B>
+    Divergence divergence(const Fleet<A>& a, const Fleet<B>& b) {
+        Divergence result{0.0, 0.0, 0.0};
+        for (int s = 0; s < SCENARIOS; s++) {
+            result.position = std::max(result.position, (a.getPosition(s) - b.getPosition(s)).norm());
+            result.velocity = std::max(result.velocity, (a.getVelocity(s) - b.getVelocity(s)).norm());
+            result.heading = std::max(result.heading,
+                                      std::abs(std::remainder(a.getHeading(s) - b.getHeading(s), 2.0 * M_PI)));
+        }
+        return result;
+    }
+}
+
+TEST(FleetTest, FloatFleetTracksDoubleReference) {
+    Fleet<double> reference;
+    Fleet<float> fleet;
+    drive(reference, 0.0, 0.0);
+    drive(fleet, 0.0, 0.0);
+
+    // The cars cover 50-130 m; float stays within millimeters of double.
+    Divergence error = divergence(reference, fleet);
+    EXPECT_LT(error.position, 0.01);
+    EXPECT_LT(error.velocity, 1e-3);
+    EXPECT_LT(error.heading, 1e-3);
+}
+
+TEST(FleetTest, DoubleFleetTracksCarThroughLaunch) {
+    // TCS and ABS off, as the fleet has neither. The fleet is fed the Car's
+    // throttle and steering after its input rate limits, so both see the same
+    // script. Off the throttle they part: the fleet has no engine braking.
+    VehicleParams params;
+    params.controllers.tcsKp = 0.0;
+    params.controllers.tcsKd = 0.0;
+    params.controllers.absKp = 0.0;
+    params.controllers.absKd = 0.0;
+    Car car(0, 0, 25, 45, params);
+    DrivingScenarios::engageFirstGear(car);
+    Fleet<double> fleet(params);
+    fleet.place(0.0, 0.0, car.angular_position);
+
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    Divergence gap{0.0, 0.0, 0.0};
+    for (int i = 0; i < std::lround(4.0 / dt); i++) {
+        VehicleInput input;
+        input.throttle = 1.0f;
+        input.steering = static_cast<float>(0.3 * std::sin(i * dt));
+        car.step(input);
+
+        Fleet<double>::Input fleetInput;
+        fleetInput.throttle = car.actualThrottle;
+        fleetInput.steering = car.steering_angle;
+        fleet.setInput(0, fleetInput);
+        fleet.step(dt);
+
+        // Car positions are in pixels, y down.
+        Eigen::Vector2d carPosition(car.pos_x / PhysicsConstants::PIXELS_PER_METER,
+                                    -car.pos_y / PhysicsConstants::PIXELS_PER_METER);
+        gap.position = std::max(gap.position, (carPosition - fleet.getPosition(0)).norm());
+        gap.velocity = std::max(gap.velocity, (car.velocity - fleet.getVelocity(0)).norm());
+        gap.heading = std::max(gap.heading,
+                               std::abs(std::remainder(car.angular_position - fleet.getHeading(0), 2.0 * M_PI)));
+    }
+
+    // About 30 m covered, weaving up to 1 rad off the start heading.
+    ASSERT_GT(car.velocity.norm(), 14.0);
+    EXPECT_LT(gap.position, 0.5);
+    EXPECT_LT(gap.velocity, 0.25);
+    EXPECT_LT(gap.heading, 0.02);
+}
+
+TEST(FleetTest, FloatingOriginKeepsFarCarsPrecise) {
+    const double far = 1e5;
+    Fleet<double> reference;
+    Fleet<float> rebased;
+    Fleet<float> absolute;
+    absolute.setFloatingOrigin(false);
+    drive(reference, far, far);
+    drive(rebased, far, far);
+    drive(absolute, far, far);
+
+    // At 1e5 m a float is 8 mm apart; each step's displacement rounds to that.
+    Divergence rebasedError = divergence(reference, rebased);
+    Divergence absoluteError = divergence(reference, absolute);
+    EXPECT_LT(rebasedError.position, 0.01);
+    EXPECT_GT(absoluteError.position, 10.0 * rebasedError.position);
+}
+
+TEST(FleetTest, RebasingLeavesDoubleFleetUnchanged) {
+    Fleet<double> rebased;
+    Fleet<double> absolute;
+    absolute.setFloatingOrigin(false);
+    drive(rebased, 300.0, -300.0);
+    drive(absolute, 300.0, -300.0);
+
+    EXPECT_LT(divergence(rebased, absolute).position, 1e-9);
+}
+
+TEST(FleetTest, EverySupportedKernelSetMatchesScalarReference) {
+    std::vector<const FleetKernels<float>*> floatKernels = supportedFleetKernels<float>();
+    std::vector<const FleetKernels<double>*> doubleKernels = supportedFleetKernels<double>();
+    ASSERT_STREQ(floatKernels.front()->name, "scalar");
+    ASSERT_STREQ(doubleKernels.front()->name, "scalar");
+
+    Fleet<float> floatReference;
+    floatReference.setKernels(*floatKernels.front());
+    drive(floatReference, 0.0, 0.0);
+    for (const FleetKernels<float>* kernels : floatKernels) {
+        Fleet<float> fleet;
+        fleet.setKernels(*kernels);
+        drive(fleet, 0.0, 0.0);
+        // Eigen's float sin/cos round differently from libm; the drift that
+        // causes is the same size as float's own against double.
+        EXPECT_LT(divergence(floatReference, fleet).position, 0.01) << kernels->name;
+    }
+
+    Fleet<double> doubleReference;
+    doubleReference.setKernels(*doubleKernels.front());
+    drive(doubleReference, 0.0, 0.0);
+    for (const FleetKernels<double>* kernels : doubleKernels) {
+        Fleet<double> fleet;
+        fleet.setKernels(*kernels);
+        drive(fleet, 0.0, 0.0);
+        EXPECT_LT(divergence(doubleReference, fleet).position, 1e-8) << kernels->name;
+    }
+}
+
+TEST(FleetTest, FindsOnlySupportedKernelSets) {
+    EXPECT_NE(findFleetKernels<float>("scalar"), nullptr);
+    EXPECT_EQ(findFleetKernels<float>("neon-on-x86"), nullptr);
+    for (const FleetKernels<double>* kernels : supportedFleetKernels<double>()) {
+        EXPECT_EQ(findFleetKernels<double>(kernels->name), kernels);
+    }
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "core/Integrator.h"
+#include "core/RigidBody.h"
+#include "vehicle/Wheel.h"
+#include "config/PhysicsConstants.h"
+#include <Eigen/Dense>
+#include <cmath>
+#include <vector>
+
+namespace {
+    // Largest deviation from the exact damped spring over two seconds.
+    template <typename Integrator>
+    double oscillatorError(double dt) {
+        const double omega = 2.0 * M_PI * 2.0;
+        const double damping = 0.1;
+        const double dampedOmega = omega * std::sqrt(1.0 - damping * damping);
+        auto accel = [&](double x, double v) { return -omega * omega * x - 2.0 * damping * omega * v; };
+
+        double x = 1.0;
+        double v = 0.0;
+        double maxError = 0.0;
+        int steps = static_cast<int>(std::lround(2.0 / dt));
+        for (int i = 1; i <= steps; i++) {
+            double displacement = 0.0;
+            Integrator::step(displacement, v, accel(x, v), [&](double dx, double dv) { return accel(x + dx, dv); }, dt);
+            x += displacement;
+
+            double t = i * dt;
+            double exact = std::exp(-damping * omega * t) *
+                           (std::cos(dampedOmega * t) + damping * omega / dampedOmega * std::sin(dampedOmega * t));
+            maxError = std::max(maxError, std::abs(x - exact));
+        }
+        return maxError;
+    }
+
+    // Driven wheel spinning up against friction at 15 m/s contact speed.
+    template <typename Integrator>
+    std::vector<double> spinUp(double dt, int stepsPerSample) {
+        Wheel wheel;
+        std::vector<double> samples;
+        int steps = static_cast<int>(std::lround(0.5 / dt));
+        for (int i = 1; i <= steps; i++) {
+            wheel.addTorque(300.0);
+            wheel.calculateFriction(Eigen::Vector2d(0.0, 15.0), PhysicsConstants::TIME_INTERVAL);
+            wheel.integrate<Integrator>(dt);
+            if (i % stepsPerSample == 0) {
+                samples.push_back(wheel.angular_velocity);
+            }
+        }
+        return samples;
+    }
+
+    double maxDifference(const std::vector<double>& a, const std::vector<double>& b) {
+        double difference = 0.0;
+        for (size_t i = 0; i < std::min(a.size(), b.size()); i++) {
+            difference = std::max(difference, std::abs(a[i] - b[i]));
+        }
+        return difference;
+    }
+}
+
+TEST(IntegratorTest, ConvergenceOrderMatchesScheme) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+
+    double eulerRatio = oscillatorError<Integrators::SemiImplicitEuler>(dt) /
+                        oscillatorError<Integrators::SemiImplicitEuler>(dt / 2.0);
+    double verletRatio = oscillatorError<Integrators::VelocityVerlet>(dt) /
+                         oscillatorError<Integrators::VelocityVerlet>(dt / 2.0);
+    double rk4Ratio = oscillatorError<Integrators::RungeKutta4>(dt) /
+                      oscillatorError<Integrators::RungeKutta4>(dt / 2.0);
+
+    // Halving the step divides the error by about 2^order.
+    EXPECT_NEAR(eulerRatio, 2.0, 0.5);
+    EXPECT_NEAR(verletRatio, 4.0, 1.0);
+    EXPECT_NEAR(rk4Ratio, 16.0, 4.0);
+    EXPECT_LT(oscillatorError<Integrators::RungeKutta4>(dt), oscillatorError<Integrators::VelocityVerlet>(dt));
+}
+
+TEST(IntegratorTest, ConstantForceIsExactForSecondOrderSchemes) {
+    auto run = [](auto integrator) {
+        using Integrator = decltype(integrator);
+        RigidBody body;
+        body.pos_x = 0.0;
+        body.pos_y = 0.0;
+        body.velocity = Eigen::Vector2d(2.0, 0.0);
+        for (int i = 0; i < 50; i++) {
+            body.addForce(Eigen::Vector2d(body.mass * 3.0, 0.0));
+            body.integrate<Integrator>(0.02, [](const Eigen::Vector3d&, const Eigen::Vector3d&) {
+                return Eigen::Vector3d(3.0, 0.0, 0.0);
+            });
+        }
+        return body.pos_x / PhysicsConstants::PIXELS_PER_METER;
+    };
+
+    // x = v t + a t^2 / 2 after one second.
+    const double exact = 2.0 + 1.5;
+    EXPECT_NEAR(run(Integrators::ConstantAcceleration{}), exact, 1e-9);
+    EXPECT_NEAR(run(Integrators::VelocityVerlet{}), exact, 1e-9);
+    EXPECT_NEAR(run(Integrators::RungeKutta4{}), exact, 1e-9);
+    EXPECT_GT(std::abs(run(Integrators::SemiImplicitEuler{}) - exact), 1e-3);
+}
+
+TEST(IntegratorTest, RungeKuttaReevaluatesWheelFriction) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    std::vector<double> reference = spinUp<Integrators::RungeKutta4>(dt / 64.0, 64);
+
+    double constantError = maxDifference(spinUp<Integrators::ConstantAcceleration>(dt, 1), reference);
+    double rk4Error = maxDifference(spinUp<Integrators::RungeKutta4>(dt, 1), reference);
+
+    EXPECT_LT(rk4Error, constantError * 0.5);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "ui/MinMaxPyramid.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+TEST(MinMaxPyramidTest, QueryMatchesRawSamplesWhileRetained) {
+    MinMaxPyramid pyramid(256, 4);
+    std::vector<double> samples;
+    for (int i = 0; i < 200; i++) {
+        double value = std::sin(i * 0.1) * 10.0 + (i % 7);
+        samples.push_back(value);
+        pyramid.append(value);
+    }
+
+    for (uint64_t begin = 0; begin < 200; begin += 13) {
+        for (uint64_t end = begin + 1; end <= 200; end += 17) {
+            MinMaxPyramid::Bucket result;
+            ASSERT_TRUE(pyramid.query(begin, end, result));
+            auto range = std::minmax_element(samples.begin() + begin, samples.begin() + end);
+            // Coarse levels may widen the envelope by a bucket on each side but never narrow it.
+            EXPECT_LE(result.min, *range.first);
+            EXPECT_GE(result.max, *range.second);
+        }
+    }
+
+    MinMaxPyramid::Bucket single;
+    ASSERT_TRUE(pyramid.query(42, 43, single));
+    EXPECT_EQ(single.min, samples[42]);
+    EXPECT_EQ(single.max, samples[42]);
+}
+
+TEST(MinMaxPyramidTest, SingleSampleSpikeSurvivesLongSpans) {
+    MinMaxPyramid pyramid;
+    const uint64_t total = 1000000;
+    const uint64_t spikeAt = 123457;
+    for (uint64_t i = 0; i < total; i++) {
+        pyramid.append(i == spikeAt ? 500.0 : 0.0);
+    }
+
+    // A column covering an hour-long view at 1 kHz is far wider than level 0 retains.
+    const uint64_t columnWidth = 3333;
+    uint64_t begin = spikeAt / columnWidth * columnWidth;
+
+    MinMaxPyramid::Bucket containing;
+    ASSERT_TRUE(pyramid.query(begin, begin + columnWidth, containing));
+    EXPECT_DOUBLE_EQ(containing.max, 500.0);
+
+    MinMaxPyramid::Bucket later;
+    ASSERT_TRUE(pyramid.query(total - columnWidth, total, later));
+    EXPECT_DOUBLE_EQ(later.max, 0.0);
+}
+
+TEST(MinMaxPyramidTest, SpikeInNewestSamplesShowsInWideQueries) {
+    // The last samples are still in partial buckets of several levels below
+    // the one a wide query reads.
+    for (uint64_t total : {1000ull, 1021ull, 4096ull, 5461ull}) {
+        for (uint64_t spikeAt = total - 30; spikeAt < total; spikeAt++) {
+            MinMaxPyramid pyramid;
+            for (uint64_t i = 0; i < total; i++) {
+                pyramid.append(i == spikeAt ? 100.0 : 0.0);
+            }
+            MinMaxPyramid::Bucket result;
+            ASSERT_TRUE(pyramid.query(0, total, result));
+            EXPECT_DOUBLE_EQ(result.max, 100.0) << total << " samples, spike at " << spikeAt;
+            ASSERT_TRUE(pyramid.query(total - 300, total, result));
+            EXPECT_DOUBLE_EQ(result.max, 100.0) << total << " samples, spike at " << spikeAt;
+        }
+    }
+}
+
+TEST(MinMaxPyramidTest, MemoryIsBoundedAndOldDataAgesOut) {
+    MinMaxPyramid pyramid(64, 3);
+    for (int i = 0; i < 100000; i++) {
+        pyramid.append(i);
+    }
+
+    // Coarsest level holds 64 buckets of 16 samples.
+    EXPECT_EQ(pyramid.getSampleCount(), 100000u);
+    EXPECT_EQ(pyramid.getOldestSample(), 100000u - 64u * 16u);
+
+    MinMaxPyramid::Bucket result;
+    EXPECT_FALSE(pyramid.query(0, 100, result));
+    ASSERT_TRUE(pyramid.query(99990, 100000, result));
+    EXPECT_DOUBLE_EQ(result.max, 99999.0);
+}
+
+TEST(MinMaxPyramidTest, LevelFollowsSpanAndPendingSamplesAreVisible) {
+    MinMaxPyramid pyramid;
+    EXPECT_EQ(pyramid.levelForSpan(1), 0u);
+    EXPECT_EQ(pyramid.levelForSpan(3), 0u);
+    EXPECT_EQ(pyramid.levelForSpan(4), 1u);
+    EXPECT_EQ(pyramid.levelForSpan(100), 3u);
+    EXPECT_EQ(pyramid.levelForSpan(1ull << 40), pyramid.getLevelCount() - 1);
+
+    // Five samples: level 1 has one full bucket and one partial one.
+    for (double value : {1.0, 2.0, 3.0, 4.0, -9.0}) {
+        pyramid.append(value);
+    }
+    MinMaxPyramid::Bucket result;
+    ASSERT_TRUE(pyramid.query(0, 5, result));
+    EXPECT_DOUBLE_EQ(result.min, -9.0);
+    EXPECT_DOUBLE_EQ(result.max, 4.0);
+    EXPECT_DOUBLE_EQ(pyramid.getLatest(), -9.0);
+
+    pyramid.clear();
+    EXPECT_EQ(pyramid.getSampleCount(), 0u);
+    EXPECT_FALSE(pyramid.query(0, 1, result));
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "core/MultiRateScheduler.h"
+#include "vehicle/Car.h"
+#include "config/PhysicsConstants.h"
+#include "DrivingScenarios.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+    using DrivingScenarios::Speeds;
+
+    // Multi-rate cars are stepped at TIME_INTERVAL, the others at dt.
+    Speeds launchAndBrake(double dt, bool multiRate) {
+        Car car(0, 0, 25, 45);
+        if (multiRate) {
+            car.setSubsystemRates(PhysicsConstants::WHEEL_RATE, PhysicsConstants::CHASSIS_RATE);
+        } else {
+            car.setTimeStep(dt);
+        }
+        return DrivingScenarios::launchAndBrake(car);
+    }
+}
+
+TEST(MultiRateSchedulerTest, RunsEachTaskAtItsRate) {
+    MultiRateScheduler scheduler;
+    std::vector<double> chassisSteps;
+    std::vector<double> graphSteps;
+    int wheel = scheduler.addTask(1000.0, [](double) {});
+    int chassis = scheduler.addTask(250.0, [&](double dt) { chassisSteps.push_back(dt); });
+    int graphs = scheduler.addTask(60.0, [&](double dt) { graphSteps.push_back(dt); });
+
+    for (int i = 0; i < 125; i++) {
+        scheduler.advance(PhysicsConstants::TIME_INTERVAL);
+    }
+
+    EXPECT_NEAR(scheduler.getTime(), 2.0, 1e-9);
+    EXPECT_EQ(scheduler.getRunCount(wheel), 2000);
+    EXPECT_EQ(scheduler.getRunCount(chassis), 500);
+    EXPECT_EQ(scheduler.getRunCount(graphs), 120);
+
+    for (double dt : chassisSteps) {
+        EXPECT_NEAR(dt, 0.004, 1e-12);
+    }
+    // 60 Hz doesn't divide 1 kHz, so samples fall 16 or 17 ticks apart.
+    double graphTime = 0.0;
+    for (double dt : graphSteps) {
+        EXPECT_TRUE(std::abs(dt - 0.016) < 1e-12 || std::abs(dt - 0.017) < 1e-12) << dt;
+        graphTime += dt;
+    }
+    EXPECT_NEAR(graphTime, 2.0, 1e-9);
+}
+
+TEST(MultiRateSchedulerTest, TasksDueTogetherRunInOrderAdded) {
+    MultiRateScheduler scheduler;
+    std::vector<int> order;
+    scheduler.addTask(1000.0, [&](double) { order.push_back(0); });
+    scheduler.addTask(250.0, [&](double) { order.push_back(1); });
+
+    scheduler.advance(0.0045);
+    EXPECT_EQ(order, std::vector<int>({0, 0, 0, 0, 1}));
+
+    // The half tick carried over completes here.
+    scheduler.advance(0.0005);
+    EXPECT_EQ(order.size(), 6u);
+}
+
+TEST(MultiRateSchedulerTest, MultiRateCarTracksFineStepReference) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    Speeds reference = launchAndBrake(dt / 16.0, false);
+    Speeds fixed = launchAndBrake(dt, false);
+    Speeds multiRate = launchAndBrake(dt, true);
+
+    EXPECT_NEAR(multiRate.launchSpeed, reference.launchSpeed, 0.01 * reference.launchSpeed);
+    // At a 16 ms step the braked wheels chatter and the car stops far later;
+    // the 1 kHz wheel loop stops like the fine step does.
+    EXPECT_NEAR(multiRate.brakeSpeed, reference.brakeSpeed, 0.5);
+    EXPECT_LT(std::abs(multiRate.brakeSpeed - reference.brakeSpeed),
+              std::abs(fixed.brakeSpeed - reference.brakeSpeed));
+}
+
+TEST(MultiRateSchedulerTest, MultiRateCarReplaysFromTelemetry) {
+    Car car(0, 0, 25, 45);
+    car.setSubsystemRates(PhysicsConstants::WHEEL_RATE, PhysicsConstants::CHASSIS_RATE);
+    DrivingScenarios::engageFirstGear(car);
+
+    VehicleInput input;
+    input.throttle = 0.8f;
+    input.steering = 0.3f;
+    TelemetryFrame start = car.captureTelemetry(0.0);
+    for (int i = 0; i < 100; i++) {
+        car.step(input);
+    }
+    TelemetryFrame first = car.captureTelemetry(0.0);
+
+    car.applyTelemetry(start);
+    for (int i = 0; i < 100; i++) {
+        car.step(input);
+    }
+    TelemetryFrame second = car.captureTelemetry(0.0);
+
+    EXPECT_EQ(first.pos_x, second.pos_x);
+    EXPECT_EQ(first.pos_y, second.pos_y);
+    EXPECT_EQ(first.angular_velocity, second.angular_velocity);
+    EXPECT_EQ(first.engine.rpm, second.engine.rpm);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "vehicle/Car.h"
+#include "telemetry/RewindBuffer.h"
+#include <vector>
+
+class RewindBufferTest : public ::testing::Test {
+protected:
+    Car* car;
+
+    void SetUp() override {
+        car = new Car(100.0, 100.0, 25, 45);
+    }
+
+    void TearDown() override {
+        delete car;
+    }
+
+    static VehicleInput inputForStep(int step) {
+        VehicleInput input;
+        input.throttle = (step % 90) < 60 ? 1.0f : 0.0f;
+        input.brake = (step % 90) >= 75 ? 1.0f : 0.0f;
+        input.steering = (step / 40) % 2 == 0 ? 0.5f : -0.5f;
+        input.clutchHeld = step < 5 ? 1 : 0;
+        input.shiftUps = step == 2 ? 1 : 0;
+        return input;
+    }
+
+    void drive(RewindBuffer& buffer, int steps, std::vector<TelemetryFrame>* states = nullptr) {
+        for (int i = 0; i < steps; i++) {
+            if (states) states->push_back(car->captureTelemetry(0.0));
+            VehicleInput input = inputForStep(static_cast<int>(buffer.getCurrentStep()));
+            buffer.record(*car, input);
+            car->step(input);
+        }
+    }
+};
+
+TEST_F(RewindBufferTest, RecordAdvancesStep) {
+    RewindBuffer buffer(10);
+    drive(buffer, 25);
+
+    EXPECT_EQ(buffer.getCurrentStep(), 25);
+    EXPECT_EQ(buffer.getOldestStep(), 0);
+}
+
+TEST_F(RewindBufferTest, RewindReproducesEarlierStateExactly) {
+    RewindBuffer buffer(16);
+    std::vector<TelemetryFrame> states;
+    drive(buffer, 200, &states);
+
+    ASSERT_TRUE(buffer.rewindTo(*car, 123));
+    EXPECT_EQ(buffer.getCurrentStep(), 123);
+
+    const TelemetryFrame& expected = states[123];
+    EXPECT_EQ(car->pos_x, expected.pos_x);
+    EXPECT_EQ(car->pos_y, expected.pos_y);
+    EXPECT_EQ(car->velocity.x(), expected.velocity_x);
+    EXPECT_EQ(car->velocity.y(), expected.velocity_y);
+    EXPECT_EQ(car->angular_position, expected.angular_position);
+    EXPECT_EQ(car->backLeft->angular_velocity, expected.wheels[2].angular_velocity);
+    EXPECT_EQ(car->getEngine().getRPM(), expected.engine.rpm);
+}
+
+TEST_F(RewindBufferTest, SimulationContinuesDeterministicallyAfterRewind) {
+    RewindBuffer buffer(16);
+    drive(buffer, 150);
+    TelemetryFrame reference = car->captureTelemetry(0.0);
+
+    ASSERT_TRUE(buffer.rewindTo(*car, 70));
+    drive(buffer, 80);
+
+    EXPECT_EQ(buffer.getCurrentStep(), 150);
+    EXPECT_EQ(car->pos_x, reference.pos_x);
+    EXPECT_EQ(car->pos_y, reference.pos_y);
+    EXPECT_EQ(car->angular_velocity, reference.angular_velocity);
+}
+
+TEST_F(RewindBufferTest, MemoryBudgetDropsOldestKeyframes) {
+    RewindBuffer buffer(10, 4096);
+    drive(buffer, 300);
+
+    EXPECT_LE(buffer.getMemoryUsage(), 4096u + sizeof(TelemetryFrame) * 2);
+    EXPECT_GT(buffer.getOldestStep(), 0);
+    EXPECT_FALSE(buffer.rewindTo(*car, 0));
+    EXPECT_TRUE(buffer.rewindTo(*car, buffer.getOldestStep()));
+}
+
+TEST_F(RewindBufferTest, RewindIntoFutureFails) {
+    RewindBuffer buffer(10);
+    drive(buffer, 20);
+
+    EXPECT_FALSE(buffer.rewindTo(*car, 21));
+    EXPECT_EQ(buffer.getCurrentStep(), 20);
+}
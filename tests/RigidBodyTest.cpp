@@ -1,7 +1,6 @@
 #include <gtest/gtest.h>
 #include "core/RigidBody.h"
 #include "config/PhysicsConstants.h"
-#include "config/RenderingConstants.h"
 #include <Eigen/Dense>
 
 class RigidBodyTest : public ::testing::Test {
@@ -26,7 +25,7 @@ TEST_F(RigidBodyTest, ConstructorInitializesCorrectly) {
     EXPECT_DOUBLE_EQ(body->angular_acceleration, 0.0);
     EXPECT_DOUBLE_EQ(body->angular_torque, 0.0);
     EXPECT_DOUBLE_EQ(body->mass, PhysicsConstants::CAR_MASS);
-    EXPECT_DOUBLE_EQ(body->moment_of_inertia, RenderingConstants::CAR_MOMENT_OF_INERTIA);
+    EXPECT_DOUBLE_EQ(body->moment_of_inertia, PhysicsConstants::CAR_MOMENT_OF_INERTIA);
 }
 
 TEST_F(RigidBodyTest, GetPositionReturnsFlooredValues) {
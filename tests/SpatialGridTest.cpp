@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "rendering/SpatialGrid.h"
+#include "rendering/Camera.h"
+#include "vehicle/Car.h"
+#include <vector>
+
+TEST(SpatialGridTest, QueryReturnsOnlyIntersectingObjectsOnce) {
+    SpatialGrid grid(100.0);
+    grid.update(0, {10, 10, 20, 20});
+    grid.update(1, {-250, -250, -240, -240});
+    // Spans four cells but must be reported once.
+    grid.update(2, {90, 90, 110, 110});
+    grid.update(3, {500, 500, 510, 510});
+
+    std::vector<int> visible;
+    grid.query({0, 0, 200, 200}, visible);
+    EXPECT_EQ(visible, (std::vector<int>{0, 2}));
+
+    grid.query({-300, -300, 0, 0}, visible);
+    EXPECT_EQ(visible, (std::vector<int>{1}));
+
+    // Same cell as object 0 but outside its bounds.
+    grid.query({50, 50, 60, 60}, visible);
+    EXPECT_TRUE(visible.empty());
+}
+
+TEST(SpatialGridTest, UpdateMovesObjectsAndRemoveDropsThem) {
+    SpatialGrid grid(100.0);
+    grid.update(4, {10, 10, 20, 20});
+    EXPECT_EQ(grid.getObjectCount(), 1u);
+    EXPECT_EQ(grid.getOccupiedCellCount(), 1u);
+
+    // Moving within the cell keeps the grid unchanged but updates the bounds.
+    grid.update(4, {30, 30, 40, 40});
+    std::vector<int> visible;
+    grid.query({0, 0, 25, 25}, visible);
+    EXPECT_TRUE(visible.empty());
+
+    grid.update(4, {1030, 30, 1040, 40});
+    grid.query({0, 0, 200, 200}, visible);
+    EXPECT_TRUE(visible.empty());
+    grid.query({1000, 0, 1100, 100}, visible);
+    EXPECT_EQ(visible, (std::vector<int>{4}));
+    EXPECT_EQ(grid.getObjectCount(), 1u);
+    EXPECT_EQ(grid.getOccupiedCellCount(), 1u);
+
+    grid.remove(4);
+    EXPECT_FALSE(grid.contains(4));
+    EXPECT_EQ(grid.getObjectCount(), 0u);
+    EXPECT_EQ(grid.getOccupiedCellCount(), 0u);
+    grid.query({1000, 0, 1100, 100}, visible);
+    EXPECT_TRUE(visible.empty());
+}
+
+TEST(SpatialGridTest, CameraViewCullsLargeFleet) {
+    SpatialGrid grid;
+    std::vector<Car*> cars;
+    for (int i = 0; i < 400; i++) {
+        Car* car = new Car((i % 20) * 1000.0, (i / 20) * 1000.0, 25, 45);
+        cars.push_back(car);
+        grid.update(i, car->getRenderBounds());
+    }
+
+    Camera camera(5012.0, 3022.0);
+    std::vector<int> visible;
+    grid.query(camera.visibleRect(800, 600), visible);
+    EXPECT_EQ(visible, (std::vector<int>{65}));
+
+    for (Car* car : cars) {
+        delete car;
+    }
+}
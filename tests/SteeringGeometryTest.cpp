@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "vehicle/SteeringGeometry.h"
+#include "vehicle/Car.h"
+#include <cmath>
+
+namespace {
+    // Car's closed form, which the table replaces.
+    SteeringGeometry<double>::WheelAngles closedForm(const VehicleParams& params, double steering) {
+        double baseAngle = steering * params.steeringRack;
+        if (std::abs(baseAngle) < 0.001) {
+            return {};
+        }
+        double turnRadius = params.wheelbase / std::tan(std::abs(baseAngle));
+        double inner = std::atan(params.wheelbase / (turnRadius - params.trackWidth / 2.0));
+        double outer = std::atan(params.wheelbase / (turnRadius + params.trackWidth / 2.0));
+        if (baseAngle > 0) {
+            return {inner, outer};
+        }
+        return {-outer, -inner};
+    }
+
+    template <typename Scalar>
+    void expectMatchesClosedForm(const VehicleParams& params, double tolerance) {
+        SteeringGeometry<Scalar> geometry(params);
+        const int samples = 20000;
+        for (int i = -samples; i <= samples; i++) {
+            double steering = params.maxSteeringAngle * i / samples;
+            typename SteeringGeometry<Scalar>::WheelAngles angles = geometry.wheelAngles(Scalar(steering));
+            SteeringGeometry<double>::WheelAngles expected = closedForm(params, double(Scalar(steering)));
+            ASSERT_NEAR(angles.left, expected.left, tolerance) << steering;
+            ASSERT_NEAR(angles.right, expected.right, tolerance) << steering;
+        }
+    }
+}
+
+TEST(SteeringGeometryTest, TableMatchesClosedFormAcrossTheRange) {
+    // The default geometry turns the inner wheel past its flip before full lock.
+    expectMatchesClosedForm<double>(VehicleParams(), 1e-10);
+
+    VehicleParams longCar;
+    longCar.wheelbase = 3.1;
+    longCar.trackWidth = 1.6;
+    longCar.steeringRack = 0.8;
+    longCar.maxSteeringAngle = 0.7;
+    expectMatchesClosedForm<double>(longCar, 1e-10);
+}
+
+TEST(SteeringGeometryTest, FloatTableAddsOnlyItsOwnRounding) {
+    expectMatchesClosedForm<float>(VehicleParams(), 2e-6);
+}
+
+TEST(SteeringGeometryTest, StraightInsideDeadbandAndBeyondLockHoldsLastEntry) {
+    VehicleParams params;
+    SteeringGeometry<double> geometry(params);
+    double deadband = SteeringGeometry<double>::DEADBAND / params.steeringRack;
+
+    EXPECT_EQ(geometry.wheelAngles(0.0).left, 0.0);
+    EXPECT_EQ(geometry.wheelAngles(0.99 * deadband).right, 0.0);
+    EXPECT_EQ(geometry.wheelAngles(-0.99 * deadband).left, 0.0);
+    EXPECT_GT(geometry.wheelAngles(1.01 * deadband).left, 0.0);
+
+    SteeringGeometry<double>::WheelAngles lock = geometry.wheelAngles(params.maxSteeringAngle);
+    SteeringGeometry<double>::WheelAngles beyond = geometry.wheelAngles(2.0 * params.maxSteeringAngle);
+    EXPECT_EQ(beyond.left, lock.left);
+    EXPECT_EQ(beyond.right, lock.right);
+}
+
+TEST(SteeringGeometryTest, CarSteersFrontWheelsThroughGeometry) {
+    VehicleParams params;
+    SteeringGeometry<double> geometry(params);
+    Car car(0.0, 0.0, 40, 80, params);
+
+    car.setSteering(0.4);
+    for (int i = 0; i < 30; i++) {
+        car.updateInputs(PhysicsConstants::TIME_INTERVAL);
+        SteeringGeometry<double>::WheelAngles expected = geometry.wheelAngles(car.steering_angle);
+        EXPECT_EQ(car.frontLeft->wheelAngle, expected.left);
+        EXPECT_EQ(car.frontRight->wheelAngle, expected.right);
+    }
+
+    car.steering_angle = -0.2;
+    car.applySteering(0.0);
+    EXPECT_EQ(car.frontLeft->wheelAngle, geometry.wheelAngles(-0.2).left);
+    EXPECT_EQ(car.frontRight->wheelAngle, geometry.wheelAngles(-0.2).right);
+    EXPECT_EQ(car.backLeft->wheelAngle, 0.0);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include "vehicle/Car.h"
+#include "telemetry/TelemetryRecorder.h"
+#include "telemetry/TelemetryReplay.h"
+#include "telemetry/GhostStreamer.h"
+#include "config/PhysicsConstants.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+class TelemetryTest : public ::testing::Test {
+protected:
+    Car* car;
+    std::string path;
+
+    void SetUp() override {
+        car = new Car(100.0, 100.0, 25, 45);
+        path = ::testing::TempDir() + "telemetry_test.bin";
+    }
+
+    void TearDown() override {
+        delete car;
+        std::remove(path.c_str());
+    }
+
+    // stampOffset shifts every frame's time, as multi-rate recordings stamp
+    // each frame at the end of its step.
+    void recordFrames(int count, double stampOffset = 0.0) {
+        TelemetryRecorder recorder;
+        ASSERT_TRUE(recorder.open(path, PhysicsConstants::TIME_INTERVAL));
+
+        car->releaseClutch();
+        car->shiftUp();
+        car->setThrottle(1.0);
+
+        for (int i = 0; i < count; i++) {
+            car->updateInputs(PhysicsConstants::TIME_INTERVAL);
+            car->updateEngine(1.0);
+            car->applyBrakes();
+            car->updateLoadTransfer();
+            car->sumWheelForces();
+            car->updateAcceleration();
+            recorder.record(*car, i * PhysicsConstants::TIME_INTERVAL + stampOffset);
+            car->incrementTime(PhysicsConstants::TIME_INTERVAL);
+            car->moveWheels();
+        }
+
+        EXPECT_EQ(recorder.getFrameCount(), static_cast<size_t>(count));
+    }
+};
+
+TEST_F(TelemetryTest, ReplayOpensRecordedFile) {
+    recordFrames(100);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+    EXPECT_EQ(replay.getFrameCount(), 100u);
+    EXPECT_DOUBLE_EQ(replay.getStartTime(), 0.0);
+    EXPECT_DOUBLE_EQ(replay.getEndTime(), 99 * PhysicsConstants::TIME_INTERVAL);
+    EXPECT_DOUBLE_EQ(replay.getTimeStep(), PhysicsConstants::TIME_INTERVAL);
+}
+
+TEST_F(TelemetryTest, ReplayRejectsMissingFile) {
+    TelemetryReplay replay;
+    EXPECT_FALSE(replay.open(path + ".missing"));
+    EXPECT_FALSE(replay.isOpen());
+}
+
+TEST_F(TelemetryTest, FindFrameReturnsFrameAtOrBeforeTime) {
+    recordFrames(50);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+
+    EXPECT_EQ(replay.findFrame(-1.0), 0u);
+    EXPECT_EQ(replay.findFrame(0.0), 0u);
+    EXPECT_EQ(replay.findFrame(10.5 * PhysicsConstants::TIME_INTERVAL), 10u);
+    EXPECT_EQ(replay.findFrame(100.0), 49u);
+}
+
+TEST_F(TelemetryTest, SeekClampsToRecording) {
+    recordFrames(50);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+
+    replay.seek(1000.0);
+    EXPECT_EQ(replay.getCurrentIndex(), 49u);
+    replay.seek(-1000.0);
+    EXPECT_EQ(replay.getCurrentIndex(), 0u);
+}
+
+TEST_F(TelemetryTest, UpdateAdvancesBySpeed) {
+    recordFrames(100);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+
+    replay.setSpeed(4.0);
+    replay.update(5 * PhysicsConstants::TIME_INTERVAL);
+    EXPECT_EQ(replay.getCurrentIndex(), 20u);
+
+    replay.setSpeed(-1.0);
+    replay.update(5 * PhysicsConstants::TIME_INTERVAL);
+    EXPECT_EQ(replay.getCurrentIndex(), 15u);
+}
+
+TEST_F(TelemetryTest, AppliedFrameRestoresCarState) {
+    recordFrames(60);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+
+    const TelemetryFrame& frame = replay.getFrame(59);
+    Car replayCar(0.0, 0.0, 25, 45);
+    replayCar.applyTelemetry(frame);
+
+    EXPECT_DOUBLE_EQ(replayCar.pos_x, frame.pos_x);
+    EXPECT_DOUBLE_EQ(replayCar.pos_y, frame.pos_y);
+    EXPECT_DOUBLE_EQ(replayCar.velocity.y(), frame.velocity_y);
+    EXPECT_DOUBLE_EQ(replayCar.backLeft->angular_velocity, frame.wheels[2].angular_velocity);
+    EXPECT_DOUBLE_EQ(replayCar.getEngine().getRPM(), frame.engine.rpm);
+    EXPECT_EQ(replayCar.getCurrentGear(), car->getCurrentGear());
+}
+
+TEST_F(TelemetryTest, GhostStreamerFollowsTimeAndSeeks) {
+    recordFrames(1000);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+
+    GhostStreamer ghosts(32);
+    ASSERT_TRUE(ghosts.addGhost(path));
+    EXPECT_FALSE(ghosts.addGhost(path + ".missing"));
+    EXPECT_EQ(ghosts.getGhostCount(), 1u);
+    ghosts.start();
+
+    auto waitForTime = [&](double time) {
+        for (int i = 0; i < 500; i++) {
+            ghosts.advance(time);
+            if (ghosts.hasFrame(0) && ghosts.getFrame(0).time >= time - 1e-9) return;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    };
+
+    double target = 10 * PhysicsConstants::TIME_INTERVAL;
+    waitForTime(target);
+    ASSERT_TRUE(ghosts.hasFrame(0));
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).time, replay.getFrame(10).time);
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).pos_y, replay.getFrame(10).pos_y);
+
+    // Jump far past the read-ahead window, then back before the current frame.
+    target = 900 * PhysicsConstants::TIME_INTERVAL;
+    ghosts.seek(target);
+    waitForTime(target);
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).time, replay.getFrame(900).time);
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).pos_y, replay.getFrame(900).pos_y);
+
+    target = 5 * PhysicsConstants::TIME_INTERVAL;
+    ghosts.seek(target);
+    waitForTime(target);
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).time, replay.getFrame(5).time);
+
+    ghosts.stop();
+}
+
+TEST_F(TelemetryTest, GhostStreamerSeeksByFrameTimestamp) {
+    recordFrames(1000, PhysicsConstants::TIME_INTERVAL);
+
+    TelemetryReplay replay;
+    ASSERT_TRUE(replay.open(path));
+
+    GhostStreamer ghosts(32);
+    ASSERT_TRUE(ghosts.addGhost(path));
+    ghosts.start();
+
+    // Frame 899 is stamped at 900 steps; the frame after it is past the target.
+    double target = 900 * PhysicsConstants::TIME_INTERVAL;
+    ghosts.seek(target);
+    for (int i = 0; i < 500 && !ghosts.hasFrame(0); i++) {
+        ghosts.advance(target);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    ASSERT_TRUE(ghosts.hasFrame(0));
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).time, replay.getFrame(899).time);
+    EXPECT_DOUBLE_EQ(ghosts.getFrame(0).pos_y, replay.getFrame(899).pos_y);
+
+    ghosts.stop();
+}
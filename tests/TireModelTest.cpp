@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "vehicle/TireModel.h"
+#include "config/PhysicsConstants.h"
+#include <cmath>
+
+namespace {
+    using Model = TireModel<double>;
+    using Lanes = Model::Lanes<4>;
+
+    // Each lane against evaluate(), relative to the tire's force capacity.
+    void expectLanesMatchScalar(const Model& model, const Lanes& angle, const Lanes& vx, const Lanes& vy,
+                                const Lanes& omega, const Lanes& load) {
+        const double dt = PhysicsConstants::TIME_INTERVAL;
+        Model::LaneForces<4> lanes = model.evaluateLanes<4>(angle, vx, vy, omega, load, dt);
+
+        for (int i = 0; i < 4; i++) {
+            Model::Force scalar = model.evaluate(angle[i], vx[i], vy[i], omega[i], load[i], dt);
+            double tolerance = 1e-12 * scalar.maxFrictionForce;
+            EXPECT_NEAR(lanes.x[i], scalar.x, tolerance) << "lane " << i;
+            EXPECT_NEAR(lanes.y[i], scalar.y, tolerance) << "lane " << i;
+            EXPECT_NEAR(lanes.frictionTorque[i], scalar.frictionTorque, tolerance) << "lane " << i;
+            EXPECT_NEAR(lanes.gripLevel[i], scalar.gripLevel, 1e-12) << "lane " << i;
+            EXPECT_NEAR(lanes.maxFrictionForce[i], scalar.maxFrictionForce, tolerance) << "lane " << i;
+        }
+    }
+}
+
+TEST(TireModelTest, LanesMatchScalarAcrossSlipRegimes) {
+    Model model = Model::fromParams(TireParams());
+    Lanes load(2000.0, 3500.0, 60.0, 5000.0);
+
+    // Rolling straight, locked, spinning up from rest and reversing.
+    expectLanesMatchScalar(model, Lanes(0.0, 0.0, 0.0, 0.0), Lanes(0.0, 0.0, 0.0, 0.0),
+                           Lanes(20.0, 20.0, 0.0, -5.0), Lanes(20.0 / 0.33, 0.0, 50.0, -5.0 / 0.33), load);
+
+    // Below the low-speed threshold, either side.
+    expectLanesMatchScalar(model, Lanes(0.1, -0.1, 0.0, 0.3), Lanes(0.2, -0.3, 0.4, -0.1),
+                           Lanes(0.1, 0.2, 0.0, -0.2), Lanes(0.0, 1.0, 0.0, -1.0), load);
+
+    // Slip angles before and past the peak, and sideways with no forward speed.
+    expectLanesMatchScalar(model, Lanes(0.0, 0.05, -0.4, 0.0), Lanes(1.0, -2.0, 6.0, 8.0),
+                           Lanes(20.0, 15.0, 10.0, 0.0), Lanes(60.0, 45.0, 30.0, 0.0), load);
+}
+
+TEST(TireModelTest, LanesAreIndependent) {
+    Model model = Model::fromParams(TireParams());
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    Lanes angle(0.2, 0.0, 0.0, -0.2);
+    Lanes vx(3.0, 0.0, 0.2, -3.0);
+    Lanes vy(20.0, 0.0, 0.1, 20.0);
+    Lanes omega(40.0, 0.0, 0.0, 80.0);
+    Lanes load(3000.0, 3000.0, 3000.0, 3000.0);
+    Model::LaneForces<4> reference = model.evaluateLanes<4>(angle, vx, vy, omega, load, dt);
+
+    // Changing one lane, even to a different regime, leaves the others alone.
+    vx[1] = 10.0;
+    vy[1] = 0.1;
+    Model::LaneForces<4> changed = model.evaluateLanes<4>(angle, vx, vy, omega, load, dt);
+    for (int i : {0, 2, 3}) {
+        EXPECT_EQ(changed.x[i], reference.x[i]);
+        EXPECT_EQ(changed.y[i], reference.y[i]);
+    }
+    EXPECT_NE(changed.y[1], reference.y[1]);
+}
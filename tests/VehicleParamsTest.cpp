@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "vehicle/Car.h"
+#include "vehicle/VehicleCatalog.h"
+#include "config/PhysicsConstants.h"
+#include "config/RenderingConstants.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+class VehicleParamsTest : public ::testing::Test {
+protected:
+    std::string path;
+
+    void SetUp() override {
+        path = ::testing::TempDir() + "vehicle_catalog_test.bin";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    static TelemetryFrame drive(Car& car, int steps) {
+        VehicleInput input;
+        input.throttle = 1.0f;
+        input.steering = 0.3f;
+        for (int i = 0; i < steps; i++) {
+            input.clutchHeld = i < 5 ? 1 : 0;
+            input.shiftUps = i == 2 ? 1 : 0;
+            car.step(input);
+        }
+        return car.captureTelemetry(0.0);
+    }
+
+    static VehicleParams namedParams(const std::string& name, double mass) {
+        VehicleParams params;
+        std::snprintf(params.name, sizeof(params.name), "%s", name.c_str());
+        params.mass = mass;
+        return params;
+    }
+};
+
+TEST_F(VehicleParamsTest, DefaultsMatchLegacyVehicle) {
+    VehicleParams params;
+    EXPECT_STREQ(params.name, "default");
+    EXPECT_DOUBLE_EQ(params.wheelbase, 1.8);
+    EXPECT_DOUBLE_EQ(params.trackWidth, 1.0);
+    EXPECT_DOUBLE_EQ(params.yawMomentOfInertia, 2650.0);
+    EXPECT_EQ(params.gearbox.gearCount, 6);
+    EXPECT_DOUBLE_EQ(params.gearbox.finalDrive, 4.2);
+
+    Car car(100.0, 100.0, 25, 45);
+    EXPECT_DOUBLE_EQ(car.mass, PhysicsConstants::CAR_MASS);
+    EXPECT_DOUBLE_EQ(car.moment_of_inertia, PhysicsConstants::CAR_MOMENT_OF_INERTIA);
+    EXPECT_DOUBLE_EQ(car.frontRight->position.x(), 1.15);
+    EXPECT_DOUBLE_EQ(car.frontRight->position.y(), 2.1);
+}
+
+TEST_F(VehicleParamsTest, ScreenSizeDoesNotChangePhysics) {
+    Car reference(100.0, 100.0, 25, 45);
+    TelemetryFrame expected = drive(reference, 200);
+
+    int savedWidth = RenderingConstants::SDL_WINDOW_WIDTH;
+    int savedLength = RenderingConstants::SDL_WINDOW_LENGTH;
+    int savedCarWidth = RenderingConstants::CAR_WIDTH;
+    int savedCarLength = RenderingConstants::CAR_LENGTH;
+    RenderingConstants::initializeScreenDependentConstants(3840, 2160);
+
+    Car car(100.0, 100.0, RenderingConstants::CAR_WIDTH, RenderingConstants::CAR_LENGTH);
+    TelemetryFrame actual = drive(car, 200);
+
+    RenderingConstants::initializeScreenDependentConstants(savedWidth, savedLength);
+    RenderingConstants::CAR_WIDTH = savedCarWidth;
+    RenderingConstants::CAR_LENGTH = savedCarLength;
+
+    EXPECT_EQ(actual.pos_x, expected.pos_x);
+    EXPECT_EQ(actual.pos_y, expected.pos_y);
+    EXPECT_EQ(actual.angular_position, expected.angular_position);
+}
+
+TEST_F(VehicleParamsTest, HeavierVehicleAcceleratesSlower) {
+    Car light(100.0, 100.0, 25, 45, namedParams("light", 900.0));
+    Car heavy(100.0, 100.0, 25, 45, namedParams("heavy", 2400.0));
+
+    TelemetryFrame lightFrame = drive(light, 150);
+    TelemetryFrame heavyFrame = drive(heavy, 150);
+
+    double lightSpeed = std::hypot(lightFrame.velocity_x, lightFrame.velocity_y);
+    double heavySpeed = std::hypot(heavyFrame.velocity_x, heavyFrame.velocity_y);
+    EXPECT_GT(lightSpeed, heavySpeed);
+}
+
+TEST_F(VehicleParamsTest, CatalogRoundTrip) {
+    std::vector<VehicleParams> vehicles;
+    for (int i = 0; i < 2000; i++) {
+        vehicles.push_back(namedParams("car-" + std::to_string(i), 800.0 + i));
+    }
+    ASSERT_TRUE(VehicleCatalog::write(path, vehicles));
+
+    VehicleCatalog catalog;
+    ASSERT_TRUE(catalog.open(path));
+    EXPECT_EQ(catalog.size(), 2000u);
+    EXPECT_DOUBLE_EQ(catalog.get(10).mass, 810.0);
+
+    const VehicleParams* found = catalog.find("car-1500");
+    ASSERT_NE(found, nullptr);
+    EXPECT_DOUBLE_EQ(found->mass, 2300.0);
+    EXPECT_DOUBLE_EQ(found->gearbox.gearRatios[0], 3.5);
+
+    EXPECT_EQ(catalog.find("car-9999"), nullptr);
+}
+
+TEST_F(VehicleParamsTest, CatalogRejectsForeignFile) {
+    FILE* out = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(out, nullptr);
+    const char junk[64] = "not a vehicle catalog";
+    std::fwrite(junk, sizeof(junk), 1, out);
+    std::fclose(out);
+
+    VehicleCatalog catalog;
+    EXPECT_FALSE(catalog.open(path));
+    EXPECT_FALSE(catalog.isOpen());
+}
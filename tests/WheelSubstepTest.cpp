@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+#include "vehicle/Car.h"
+#include "config/PhysicsConstants.h"
+#include "DrivingScenarios.h"
+#include <cmath>
+
+namespace {
+    using DrivingScenarios::Speeds;
+
+    Speeds launchAndBrake(double dt, int wheelSubsteps) {
+        Car car(0, 0, 25, 45);
+        car.setTimeStep(dt);
+        car.setWheelSubsteps(wheelSubsteps);
+        return DrivingScenarios::launchAndBrake(car);
+    }
+}
+
+TEST(WheelSubstepTest, SubstepsTrackFineStepReference) {
+    const double dt = PhysicsConstants::TIME_INTERVAL;
+    Speeds reference = launchAndBrake(dt / 16.0, 1);
+    Speeds fixed = launchAndBrake(dt, 1);
+    Speeds substepped = launchAndBrake(dt, 16);
+
+    EXPECT_NEAR(substepped.launchSpeed, reference.launchSpeed, 0.01 * reference.launchSpeed);
+    // Whole 16 ms wheel steps chatter under braking and the car stops far
+    // later; 1 ms wheel substeps stop like the fine step, chassis and all.
+    EXPECT_NEAR(substepped.brakeSpeed, reference.brakeSpeed, 0.5);
+    EXPECT_LT(std::abs(substepped.brakeSpeed - reference.brakeSpeed),
+              std::abs(fixed.brakeSpeed - reference.brakeSpeed));
+}